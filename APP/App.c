@@ -12,21 +12,94 @@
 /* MCAL Headers */
 #include "Port.h"
 #include "Dio.h"
+#include "Icu.h"
+#include "Gpt.h"
+#include "Pwm.h"
+#include "Eep.h"
+#include "Uart.h"
 
 /* HAL Headers */
 #include "Button.h"
 #include "Led.h"
 
+/* Services */
+#include "Det.h"
+#include "Dem.h"
+
+/* Benchmark */
+#include "Bench.h"
+
 /* Module Headers */
 #include "App.h"
 
+/* Latency of a button action above which the button latency event is reported failed (50 ms) */
+#define APP_BUTTON_LATENCY_LIMIT_CYCLES (800000U)
+
+#if (UART_ENABLED == STD_ON)
+/* Sent on UART0 once the drivers are initialized */
+static const uint8 App_BootMessage[] = "AUTOSAR_Project started\r\n";
+#endif
+
+/* Heartbeat of LED2: two short flashes every second */
+static const Led_StepType App_HeartbeatSteps[] = {
+	{LED_MAX_BRIGHTNESS, 100U},
+	{0U, 100U},
+	{LED_MAX_BRIGHTNESS, 100U},
+	{0U, 700U},
+};
+
+static const Led_PatternType App_HeartbeatPattern = {
+	.Steps = App_HeartbeatSteps,
+	.Step_Count = (uint8)(sizeof(App_HeartbeatSteps) / sizeof(App_HeartbeatSteps[0])),
+	.Repeat = LED_PATTERN_FOREVER,
+};
+
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
 {
+	/* Initialize the Det first, it time stamps the errors reported by the next drivers */
+	Det_Init();
 	/* Initialize Port Driver */
 	Port_Init(&Port_Configuration);
 	/* Initialize Dio Driver */
 	Dio_Init(&Dio_Configuration);
+	/* Initialize Icu Driver */
+	Icu_Init(&Icu_Configuration);
+	/* Initialize Gpt Driver */
+	Gpt_Init(&Gpt_Configuration);
+	/* Initialize Pwm Driver */
+	Pwm_Init(&Pwm_Configuration);
+	/* Initialize Eep Driver */
+	Eep_Init();
+	/* Initialize the Dem after the Eep driver, it loads the event memory from the EEPROM */
+	Dem_Init(&Dem_Configuration);
+	/* Initialize the buttons after the drivers of their edge interrupt and sampling timer */
+	BUTTON_init();
+	/* Initialize the LED fades and patterns after the Pwm and Gpt drivers */
+	LED_init();
+
+#if (BENCH_API == STD_ON)
+	/* Measure the drivers before the tasks start using them */
+	Bench_Run();
+#endif
+
+#if (UART_ENABLED == STD_ON)
+	/* PA0/PA1 to UART0 once the benchmark, which applies the sleep profile, is over */
+	#if (PORT_APPLY_PROFILE_API == STD_ON)
+	Port_ApplyProfile(PortConf_UART0_ACTIVE_PROFILE_ID);
+	#elif (PORT_SET_PIN_MODE_API == STD_ON)
+	Port_SetPinMode(PortConf_PA0_PIN_ID_INDEX, PORT_U0RX_MODE);
+	Port_SetPinMode(PortConf_PA1_PIN_ID_INDEX, PORT_U0TX_MODE);
+	#else
+		#error "UART_ENABLED needs PORT_APPLY_PROFILE_API or PORT_SET_PIN_MODE_API to switch PA0/PA1 to UART0"
+	#endif
+	/* Initialize the Uart driver, its interrupt is installed in the table set up by Os_start */
+	Uart_Init();
+	(void)Uart_Write(App_BootMessage, sizeof(App_BootMessage) - 1U);
+#endif
+
+	/* LED2 blinks on its own, the pattern timer only wakes up at its transitions */
+	LED_startPattern(LedConf_LED2_ID, &App_HeartbeatPattern);
 }
 
 /* Description: Task executes every 20 Mili-seconds to check the button state */
@@ -35,26 +108,62 @@ void Button_Task(void)
 	BUTTON_refreshState();
 }
 
-/* Description: Task executes every 40 Mili-seconds to refresh the LED */
+/* Description: Task executes every 40 Mili-seconds to refresh the LED, a PWM LED needs no refresh */
 void Led_Task(void)
 {
+#if (LED_PWM_API == STD_OFF)
 	LED_refreshOutput();
+#endif
 }
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task executes every 60 Mili-seconds, the button events are handled by App_ButtonNotification */
 void App_Task(void)
 {
-	static uint8 button_previous_state = BUTTON_RELEASED;
-	static uint8 button_current_state = BUTTON_RELEASED;
+}
 
-	button_current_state = BUTTON_getState(); /* Read the button state */
+/* Description: Task executes every 120 Mili-seconds to debounce the faults and write them to the EEPROM */
+void Dem_Task(void)
+{
+	Dem_MainFunction();
+	/* Programs the words of the event memory write started by Dem_MainFunction */
+	Eep_MainFunction();
+}
+
+/* Description: Freeze frame data of the button latency event, the worst button latency in DWT cycles */
+uint32 App_ButtonLatencyFreezeFrame(void)
+{
+	return BUTTON_getLatency()->Max_Cycles;
+}
 
-	/* Only Toggle the led in case the current state of the switch is pressed
-     * and the previous state is released */
-	if ((button_current_state == BUTTON_PRESSED) && (button_previous_state == BUTTON_RELEASED))
+/* Description: Called by the Button module as soon as events are queued, toggles the led on SW1 press.
+ * SW2 held for 10 s is reported as stuck and SW1 actions slower than 50 ms as a latency fault. */
+void App_ButtonNotification(void)
+{
+	Button_EventType event;
+
+	while (E_OK == BUTTON_getEvent(&event))
 	{
-		LED_toggle();
-	}
+		if ((ButtonConf_SW1_ID == event.ButtonId) && (BUTTON_EVENT_PRESSED == event.Kind))
+		{
+			LED_toggle();
+			BUTTON_reportAction(&event);
 
-	button_previous_state = button_current_state;
+			(void)Dem_SetEventStatus(DemConf_BUTTON_LATENCY_EVENT_ID,
+									 (BUTTON_getLatency()->Last_Cycles > APP_BUTTON_LATENCY_LIMIT_CYCLES)
+										 ? DEM_EVENT_STATUS_PREFAILED
+										 : DEM_EVENT_STATUS_PREPASSED);
+		}
+		else if ((ButtonConf_SW2_ID == event.ButtonId) && (BUTTON_EVENT_PRESSED == event.Kind))
+		{
+			(void)Dem_SetEventStatus(DemConf_SW2_STUCK_EVENT_ID, DEM_EVENT_STATUS_PREFAILED);
+		}
+		else if ((ButtonConf_SW2_ID == event.ButtonId) && (BUTTON_EVENT_RELEASED == event.Kind))
+		{
+			(void)Dem_SetEventStatus(DemConf_SW2_STUCK_EVENT_ID, DEM_EVENT_STATUS_PREPASSED);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
 }
@@ -23,7 +23,16 @@ void Button_Task(void);
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void);
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task executes every 60 Mili-seconds, the button events are handled by App_ButtonNotification */
 void App_Task(void);
 
+/* Description: Task executes every 120 Mili-seconds to debounce the faults and write them to the EEPROM */
+void Dem_Task(void);
+
+/* Description: Freeze frame data of the button latency event, the worst button latency in DWT cycles */
+uint32 App_ButtonLatencyFreezeFrame(void);
+
+/* Description: Called by the Button module as soon as events are queued, toggles the led on SW1 press */
+void App_ButtonNotification(void);
+
 #endif /* APP_H_ */
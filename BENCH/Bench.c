@@ -0,0 +1,239 @@
+/******************************************************************
+ * @Module   	: Bench
+ * @Title 	 	: Driver Benchmark Source file
+ * @Filename 	: Bench.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	: The results are printed through the C-SPY terminal I/O (semihosting)
+ ********************************************************************/
+
+#include <stdio.h>
+
+#include "Bench.h"
+#include "Dio.h"
+#include "Port.h"
+#include "Dwt.h"
+
+/* Function measured by one benchmark case */
+typedef void (*Bench_CaseFunctionType)(void);
+
+typedef struct
+{
+	const char*			   Name;
+	Bench_CaseFunctionType Function;
+} Bench_CaseType;
+
+/* LED1 and LED2 (PF1, PF2) read and written as one group */
+STATIC const Dio_ChannelGroupType Bench_LedGroup = {
+	.mask = 0x03U,
+	.offset = 1U,
+	.PortIndex = DioConf_LED1_PORT_NUM,
+};
+
+/* Results are volatile so that the calls and the sink are not optimized away */
+STATIC volatile Dio_PortLevelType Bench_Sink;
+
+/************************************************************************************
+ * Benchmark cases. The LEDs (PF1 - PF3) are driven by M1PWM5 - 7 and no pin is a Dio output any
+ * more: the GPIODATA stores of the write cases do not reach the pins, only their cost on the bus
+ * and in the driver is measured (masked alias against read-modify-write included).
+ ************************************************************************************/
+STATIC void Bench_Empty(void)
+{
+}
+
+STATIC void Bench_DioWriteChannel(void)
+{
+	Dio_WriteChannel(DioConf_LED2_CHANNEL_ID_INDEX, STD_LOW);
+}
+
+STATIC void Bench_DioReadChannel(void)
+{
+	Bench_Sink = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+}
+
+STATIC void Bench_DioReadPort(void)
+{
+	Bench_Sink = Dio_ReadPort(DioConf_SW1_PORT_NUM);
+}
+
+STATIC void Bench_DioReadChannelGroup(void)
+{
+	Bench_Sink = Dio_ReadChannelGroup(&Bench_LedGroup);
+}
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+STATIC void Bench_DioFlipChannel(void)
+{
+	Bench_Sink = Dio_FlipChannel(DioConf_LED2_CHANNEL_ID_INDEX);
+}
+#endif
+
+/* Same calls to the unchecked cores (what the DIO_xxx macros call), the difference with the cases
+ * above is the cost of the DET checks of the arguments in this image */
+STATIC void Bench_DioWriteChannelUnchecked(void)
+{
+	Dio_WriteChannelUnchecked(DioConf_LED2_CHANNEL_ID_INDEX, STD_LOW);
+}
+
+STATIC void Bench_DioReadChannelUnchecked(void)
+{
+	Bench_Sink = Dio_ReadChannelUnchecked(DioConf_SW1_CHANNEL_ID_INDEX);
+}
+
+STATIC void Bench_DioReadPortUnchecked(void)
+{
+	Bench_Sink = Dio_ReadPortUnchecked(DioConf_SW1_PORT_NUM);
+}
+
+STATIC void Bench_DioReadChannelGroupUnchecked(void)
+{
+	Bench_Sink = Dio_ReadChannelGroupUnchecked(&Bench_LedGroup);
+}
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+STATIC void Bench_DioFlipChannelUnchecked(void)
+{
+	Bench_Sink = Dio_FlipChannelUnchecked(DioConf_LED2_CHANNEL_ID_INDEX);
+}
+#endif
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+STATIC void Bench_PortSetPinDirection(void)
+{
+	Port_SetPinDirection(PortConf_PF3_PIN_ID_INDEX, PORT_PIN_OUT);
+}
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+STATIC void Bench_PortSetPinMode(void)
+{
+	/* Same mode as configured, the green LED stays on its PWM output */
+	Port_SetPinMode(PortConf_PF3_PIN_ID_INDEX, PortConf_PF3_PIN_MODE);
+}
+#endif
+
+STATIC void Bench_PortRefreshPortDirection(void)
+{
+	Port_RefreshPortDirection();
+}
+
+#if (PORT_APPLY_PROFILE_API == STD_ON)
+/* The sleep profile is the configuration set by Port_Init, so the UART0 pins do not change */
+STATIC void Bench_PortApplyProfile(void)
+{
+	Port_ApplyProfile(PortConf_UART0_SLEEP_PROFILE_ID);
+}
+#endif
+
+STATIC const Bench_CaseType Bench_Cases[] = {
+	{"Dio_WriteChannel", Bench_DioWriteChannel},
+	{"Dio_ReadChannel", Bench_DioReadChannel},
+	{"Dio_ReadPort", Bench_DioReadPort},
+	{"Dio_ReadChannelGroup", Bench_DioReadChannelGroup},
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+	{"Dio_FlipChannel", Bench_DioFlipChannel},
+#endif
+	{"Dio_WriteChannelUnchecked", Bench_DioWriteChannelUnchecked},
+	{"Dio_ReadChannelUnchecked", Bench_DioReadChannelUnchecked},
+	{"Dio_ReadPortUnchecked", Bench_DioReadPortUnchecked},
+	{"Dio_ReadChannelGroupUnchecked", Bench_DioReadChannelGroupUnchecked},
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+	{"Dio_FlipChannelUnchecked", Bench_DioFlipChannelUnchecked},
+#endif
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+	{"Port_SetPinDirection", Bench_PortSetPinDirection},
+#endif
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+	{"Port_SetPinMode", Bench_PortSetPinMode},
+#endif
+	{"Port_RefreshPortDirection", Bench_PortRefreshPortDirection},
+#if (PORT_APPLY_PROFILE_API == STD_ON)
+	{"Port_ApplyProfile", Bench_PortApplyProfile},
+#endif
+};
+
+#define BENCH_CASES (sizeof(Bench_Cases) / sizeof(Bench_Cases[0]))
+
+STATIC Bench_ResultType Bench_Results[BENCH_CASES];
+
+/* Cycles of every call of the case being measured */
+STATIC uint32 Bench_Samples[BENCH_ITERATIONS];
+
+/************************************************************************************
+* Function Name		: Bench_Measure
+* Description		: Calls Function BENCH_ITERATIONS times, removes Overhead from every sample
+*					  and returns min/median/max. The samples are sorted with an insertion sort
+*					  (the array is small and mostly sorted already).
+************************************************************************************/
+STATIC void Bench_Measure(Bench_CaseFunctionType Function, uint32 Overhead, Bench_ResultType* Result)
+{
+	for (uint32 Iteration = 0U; Iteration < BENCH_ITERATIONS; Iteration++)
+	{
+		uint32 Start = BENCH_GET_CYCLES();
+		Function();
+		uint32 Cycles = BENCH_GET_CYCLES() - Start;
+
+		Bench_Samples[Iteration] = (Cycles > Overhead) ? (Cycles - Overhead) : 0U;
+	}
+
+	for (uint32 Index = 1U; Index < BENCH_ITERATIONS; Index++)
+	{
+		uint32 Sample = Bench_Samples[Index];
+		uint32 Position = Index;
+
+		while ((Position > 0U) && (Bench_Samples[Position - 1U] > Sample))
+		{
+			Bench_Samples[Position] = Bench_Samples[Position - 1U];
+			Position--;
+		}
+
+		Bench_Samples[Position] = Sample;
+	}
+
+	Result->Min = Bench_Samples[0];
+	Result->Median = Bench_Samples[BENCH_ITERATIONS / 2U];
+	Result->Max = Bench_Samples[BENCH_ITERATIONS - 1U];
+}
+
+/*********************************************************************************************/
+void Bench_Run(void)
+{
+	Bench_ResultType Calibration;
+
+	DWT_CYCLE_COUNTER_ENABLE();
+
+	/* Cost of the call and of the two counter reads, removed from every case */
+	Bench_Measure(Bench_Empty, 0U, &Calibration);
+
+	printf("Bench: %u iterations, overhead %lu cycles, DIO DET %s, PORT DET %s\n", (unsigned int)BENCH_ITERATIONS,
+		   (unsigned long)Calibration.Min, (DIO_DEV_ERROR_DETECT == STD_ON) ? "ON" : "OFF",
+		   (PORT_DEV_ERROR_DETECT == STD_ON) ? "ON" : "OFF");
+
+	for (uint8 CaseId = 0U; CaseId < BENCH_CASES; CaseId++)
+	{
+		Bench_Measure(Bench_Cases[CaseId].Function, Calibration.Min, &Bench_Results[CaseId]);
+
+		printf("%-30s min %5lu  median %5lu  max %5lu\n", Bench_Cases[CaseId].Name,
+			   (unsigned long)Bench_Results[CaseId].Min, (unsigned long)Bench_Results[CaseId].Median,
+			   (unsigned long)Bench_Results[CaseId].Max);
+	}
+}
+
+/*********************************************************************************************/
+const Bench_ResultType* Bench_GetResult(uint8 CaseId)
+{
+	const Bench_ResultType* Result = NULL_PTR;
+
+	if (CaseId < BENCH_CASES)
+	{
+		Result = &Bench_Results[CaseId];
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Result;
+}
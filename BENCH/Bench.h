@@ -0,0 +1,34 @@
+/******************************************************************
+ * @Module   	: Bench
+ * @Title 	 	: Driver Benchmark Header
+ * @Filename 	: Bench.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: Measures the cost of the Dio and Port APIs in CPU cycles. The Dio APIs
+ *                are also measured through their unchecked cores, so one image gives the
+ *                cost of the DET checks. The DET settings it was built with are printed.
+ ********************************************************************/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "Std_Types.h"
+#include "Bench_Cfg.h"
+
+/* Result of one benchmarked API, in cycles with the measurement overhead removed */
+typedef struct
+{
+	uint32 Min;
+	uint32 Median;
+	uint32 Max;
+} Bench_ResultType;
+
+/* Description: Run every benchmark case BENCH_ITERATIONS times and print min/median/max cycles,
+ * the Port and Dio drivers shall be initialized before */
+void Bench_Run(void);
+
+/* Description: Get the result of the case CaseId (in the order printed by Bench_Run) */
+const Bench_ResultType* Bench_GetResult(uint8 CaseId);
+
+#endif /* BENCH_H */
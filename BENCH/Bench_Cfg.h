@@ -0,0 +1,25 @@
+/******************************************************************
+ * @Module   	: Bench
+ * @Title 	 	: Driver Benchmark Configuration Header
+ * @Filename 	: Bench_Cfg.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: 
+ ********************************************************************/
+
+#ifndef BENCH_CFG_H
+#define BENCH_CFG_H
+
+/* Pre-compile option to run the driver benchmark from the Init Task */
+#define BENCH_API		   (STD_OFF)
+
+/* Number of measured calls of every API */
+#define BENCH_ITERATIONS   (64U)
+
+/* Cycle counter read before and after every measured call, started by Bench_Run */
+#ifndef BENCH_GET_CYCLES
+	#define BENCH_GET_CYCLES() DWT_GET_CYCLES()
+#endif
+
+#endif /* BENCH_CFG_H */
@@ -11,52 +11,486 @@
 #include "Dio.h"
 #include "Port.h"
 #include "Button.h"
+#include "Os.h"
+#include "Dwt.h"
 
-/* Button Configurations Structure */
-//static Port_ConfigType g_Button_Config;
+/* Compile-time masks of the buttons of one port slot, bit n of every mask belongs to pin n */
+typedef struct
+{
+	Dio_PortType Dio_Port;
+	uint8		 Pins;		 /* pins with a button */
+	uint8		 Active_Low; /* buttons pressed when the pin is low */
+	uint8		 Limit[3];	 /* debounce samples of every pin as 3 bit planes */
+	uint8		 Divider[3]; /* pins sampled every 2nd, 4th and 8th refresh */
+} Button_PortConfigType;
+
+/* Debounce state of the buttons of one port slot, bit n of every field belongs to pin n */
+typedef struct
+{
+	uint8 Pressed;	/* debounced state */
+	uint8 Changed;	/* pins that changed state on the last refresh */
+	uint8 Count[3]; /* vertical counters of consecutive samples different from Pressed */
+} Button_PortStateType;
+
+/* Port slot, pin and Icu channel of a button */
+typedef struct
+{
+	uint8			Slot;
+	uint8			Mask;
+	Icu_ChannelType Icu_Channel;
+} Button_InstanceType;
+
+/************************************************************************************
+ * Helpers building the tables from Button_Cfg.h, the mask macros expand to
+ * "| <bit of the pin>" when button B is on the port slot SLOT and to "| 0" otherwise
+ ************************************************************************************/
+#define BUTTON_PIN_IF(SLOT, B, CONDITION) \
+	((((SLOT) == ButtonConf_##B##_PORT_SLOT) && (CONDITION)) ? (1U << ButtonConf_##B##_PIN_NUM) : 0U)
+#define BUTTON_LIMIT_BIT(B, BIT)		(0U != (ButtonConf_##B##_DEBOUNCE_SAMPLES & (BIT)))
+
+#define BUTTON_MASK_PINS(SLOT, B)		| BUTTON_PIN_IF(SLOT, B, TRUE)
+#define BUTTON_MASK_ACTIVE_LOW(SLOT, B)	| BUTTON_PIN_IF(SLOT, B, STD_LOW == ButtonConf_##B##_ACTIVE_LEVEL)
+#define BUTTON_MASK_LIMIT0(SLOT, B)		| BUTTON_PIN_IF(SLOT, B, BUTTON_LIMIT_BIT(B, 1U))
+#define BUTTON_MASK_LIMIT1(SLOT, B)		| BUTTON_PIN_IF(SLOT, B, BUTTON_LIMIT_BIT(B, 2U))
+#define BUTTON_MASK_LIMIT2(SLOT, B)		| BUTTON_PIN_IF(SLOT, B, BUTTON_LIMIT_BIT(B, 4U))
+#define BUTTON_MASK_DIV2(SLOT, B)		| BUTTON_PIN_IF(SLOT, B, 2U == ButtonConf_##B##_SAMPLE_DIVIDER)
+#define BUTTON_MASK_DIV4(SLOT, B)		| BUTTON_PIN_IF(SLOT, B, 4U == ButtonConf_##B##_SAMPLE_DIVIDER)
+#define BUTTON_MASK_DIV8(SLOT, B)		| BUTTON_PIN_IF(SLOT, B, 8U == ButtonConf_##B##_SAMPLE_DIVIDER)
+
+#define BUTTON_SLOT_MASK(SLOT, MASK)	(uint8)(0U BUTTON_BUTTONS(MASK, SLOT))
+
+/* Masks of the buttons of the port slot SLOT */
+#define BUTTON_PORT_CONFIG(SLOT)                                         \
+	{                                                                    \
+		.Dio_Port = ButtonConf_PORT##SLOT##_DIO_PORT,                    \
+		.Pins = BUTTON_SLOT_MASK(SLOT##U, BUTTON_MASK_PINS),             \
+		.Active_Low = BUTTON_SLOT_MASK(SLOT##U, BUTTON_MASK_ACTIVE_LOW), \
+		.Limit =                                                         \
+			{                                                            \
+				BUTTON_SLOT_MASK(SLOT##U, BUTTON_MASK_LIMIT0),           \
+				BUTTON_SLOT_MASK(SLOT##U, BUTTON_MASK_LIMIT1),           \
+				BUTTON_SLOT_MASK(SLOT##U, BUTTON_MASK_LIMIT2),           \
+			},                                                           \
+		.Divider =                                                       \
+			{                                                            \
+				BUTTON_SLOT_MASK(SLOT##U, BUTTON_MASK_DIV2),             \
+				BUTTON_SLOT_MASK(SLOT##U, BUTTON_MASK_DIV4),             \
+				BUTTON_SLOT_MASK(SLOT##U, BUTTON_MASK_DIV8),             \
+			},                                                           \
+	}
+
+/* Port slot, pin and Icu channel of button B */
+#define BUTTON_INSTANCE(ARG, B)                                                                   \
+	[ButtonConf_##B##_ID] = {ButtonConf_##B##_PORT_SLOT, (uint8)(1U << ButtonConf_##B##_PIN_NUM), \
+							 ButtonConf_##B##_ICU_CHANNEL},
+
+/* One entry per port slot of Button_Cfg.h */
+static const Button_PortConfigType Button_Ports[BUTTON_CONFIGURED_PORTS] = {
+	BUTTON_PORT_CONFIG(0),
+};
+
+static const Button_InstanceType Button_Instances[BUTTON_CONFIGURED_BUTTONS] = {
+	BUTTON_BUTTONS(BUTTON_INSTANCE, 0U)};
+
+/* Global variable to hold the state of the buttons of every port slot */
+static Button_PortStateType g_Button_PortState[BUTTON_CONFIGURED_PORTS];
+
+/* Number of refreshes, selects the pins sampled by the refresh for the sample dividers */
+static uint8 g_Button_RefreshCount = 0;
+
+/* Gesture state of the buttons, bit n of the bitmaps belongs to the button ID n */
+static uint32 g_Button_LongPressed = 0; /* long-press event sent for the current press */
+static uint32 g_Button_ClickPending = 0; /* short press released, waiting for a second one */
+static uint32 g_Button_PressTime[BUTTON_CONFIGURED_BUTTONS];
+static uint32 g_Button_ClickTime[BUTTON_CONFIGURED_BUTTONS];  /* release time of the pending click */
+static uint32 g_Button_RepeatTime[BUTTON_CONFIGURED_BUTTONS]; /* time of the next repeat event */
+
+/* DWT cycles at the last edge of every button, copied to its events */
+static uint32 g_Button_EdgeCycles[BUTTON_CONFIGURED_BUTTONS];
+
+static Button_LatencyType g_Button_Latency;
+
+#if (BUTTON_EDGE_TRIGGER == STD_ON)
+/* Buttons whose Icu edge detection is enabled, it is disabled from the edge until they are settled */
+static uint32 g_Button_EdgeArmed = 0;
+#endif
+
+/* Event consumer provided by the application */
+extern void BUTTON_EVENT_NOTIFICATION(void);
+
+/* Event queue, written by BUTTON_refreshState and read by BUTTON_getEvent */
+static Button_EventType g_Button_Events[BUTTON_EVENT_QUEUE_SIZE];
+static volatile uint8	g_Button_EventHead = 0; /* next entry to write */
+static volatile uint8	g_Button_EventTail = 0; /* next entry to read */
+static uint8			g_Button_LostEvents = 0;
+
+/* Description: Push an event to the queue, it is dropped and counted if the queue is full */
+static void BUTTON_pushEvent(uint8 ButtonId, Button_EventKindType Kind, uint32 Now)
+{
+	uint8 head = g_Button_EventHead;
+
+	if ((uint8)(head - g_Button_EventTail) < BUTTON_EVENT_QUEUE_SIZE)
+	{
+		Button_EventType* event = &g_Button_Events[head & (BUTTON_EVENT_QUEUE_SIZE - 1U)];
+
+		event->Timestamp = Now;
+		event->Edge_Cycles = g_Button_EdgeCycles[ButtonId];
+		event->ButtonId = ButtonId;
+		event->Kind = Kind;
+		g_Button_EventHead = head + 1U;
+	}
+	else
+	{
+		g_Button_LostEvents++;
+	}
+}
+
+/* Description: Send the pending click of a button as a single click */
+static void BUTTON_flushClick(uint8 ButtonId, uint32 Bit)
+{
+	if (0U != (g_Button_ClickPending & Bit))
+	{
+		BUTTON_pushEvent(ButtonId, BUTTON_EVENT_CLICK, g_Button_ClickTime[ButtonId]);
+		g_Button_ClickPending &= ~Bit;
+	}
+}
+
+/* 
+ * Description: Generate the gesture events of one button from its debounced state. A short press
+ *              released leaves a pending click, a second press within BUTTON_DOUBLE_CLICK_TIME_MS
+ *              turns it into a double-click on its release, otherwise it is sent as a single click.
+ */
+static void BUTTON_updateGestures(uint8 ButtonId, boolean Pressed, boolean Changed, uint32 Now)
+{
+	uint32 bit = (uint32)1U << ButtonId;
 
-/* Global variable to hold the button state */
-static uint8 g_button_state = BUTTON_RELEASED;
+	if (Changed && Pressed)
+	{
+		/* Second press too late for a double-click */
+		if ((Now - g_Button_ClickTime[ButtonId]) > BUTTON_DOUBLE_CLICK_TIME_MS)
+		{
+			BUTTON_flushClick(ButtonId, bit);
+		}
+
+		BUTTON_pushEvent(ButtonId, BUTTON_EVENT_PRESSED, Now);
+		g_Button_PressTime[ButtonId] = Now;
+		g_Button_LongPressed &= ~bit;
+	}
+	else if (Changed)
+	{
+		BUTTON_pushEvent(ButtonId, BUTTON_EVENT_RELEASED, Now);
+
+		/* Only short presses count as clicks */
+		if (0U != (g_Button_LongPressed & bit))
+		{
+			/* Do Nothing */
+		}
+		else if (0U != (g_Button_ClickPending & bit))
+		{
+			BUTTON_pushEvent(ButtonId, BUTTON_EVENT_DOUBLE_CLICK, Now);
+			g_Button_ClickPending &= ~bit;
+		}
+		else
+		{
+			g_Button_ClickPending |= bit;
+			g_Button_ClickTime[ButtonId] = Now;
+		}
+	}
+	else if (Pressed)
+	{
+		if (0U == (g_Button_LongPressed & bit))
+		{
+			if ((Now - g_Button_PressTime[ButtonId]) >= BUTTON_LONG_PRESS_TIME_MS)
+			{
+				BUTTON_flushClick(ButtonId, bit);
+				BUTTON_pushEvent(ButtonId, BUTTON_EVENT_LONG_PRESS, Now);
+				g_Button_LongPressed |= bit;
+				g_Button_RepeatTime[ButtonId] = Now + BUTTON_REPEAT_PERIOD_MS;
+			}
+		}
+		else if ((sint32)(Now - g_Button_RepeatTime[ButtonId]) >= 0)
+		{
+			BUTTON_pushEvent(ButtonId, BUTTON_EVENT_REPEAT, Now);
+			g_Button_RepeatTime[ButtonId] += BUTTON_REPEAT_PERIOD_MS;
+		}
+	}
+	else if ((Now - g_Button_ClickTime[ButtonId]) > BUTTON_DOUBLE_CLICK_TIME_MS)
+	{
+		/* No second press came in time */
+		BUTTON_flushClick(ButtonId, bit);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
 
 /*******************************************************************************************************************/
-uint8 BUTTON_getState(void)
+uint8 BUTTON_getState(uint8 ButtonId)
 {
-	return g_button_state;
+	uint8 state = BUTTON_RELEASED;
+
+	if ((ButtonId < BUTTON_CONFIGURED_BUTTONS) &&
+		(0U != (g_Button_PortState[Button_Instances[ButtonId].Slot].Pressed & Button_Instances[ButtonId].Mask)))
+	{
+		state = BUTTON_PRESSED;
+	}
+
+	return state;
 }
 
 /*******************************************************************************************************************/
-void BUTTON_refreshState(void)
+uint8 BUTTON_getPressedMask(uint8 PortSlot)
 {
-	uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+	return (PortSlot < BUTTON_CONFIGURED_PORTS) ? g_Button_PortState[PortSlot].Pressed : 0U;
+}
 
-	/* Count the number of Pressed times increment if the switch pressed for 20 ms */
-	static uint8 g_Pressed_Count = 0;
+/*******************************************************************************************************************/
+uint8 BUTTON_getChangedMask(uint8 PortSlot)
+{
+	return (PortSlot < BUTTON_CONFIGURED_PORTS) ? g_Button_PortState[PortSlot].Changed : 0U;
+}
 
-	/* Count the number of Released times increment if the switch released for 20 ms */
-	static uint8 g_Released_Count = 0;
+/*******************************************************************************************************************/
+Std_ReturnType BUTTON_getEvent(Button_EventType* Event)
+{
+	Std_ReturnType result = E_NOT_OK;
+	uint8		   tail = g_Button_EventTail;
 
-	if (state == BUTTON_PRESSED)
+	if ((NULL_PTR != Event) && (tail != g_Button_EventHead))
 	{
-		g_Pressed_Count++;
-		g_Released_Count = 0;
+		*Event = g_Button_Events[tail & (BUTTON_EVENT_QUEUE_SIZE - 1U)];
+		g_Button_EventTail = tail + 1U;
+		result = E_OK;
 	}
-	else
+
+	return result;
+}
+
+/* 
+ * Description: Sample and debounce all the port slots once, then update the gestures and notify the
+ *              application if events were pushed. Returns TRUE while a debounce counter is running.
+ */
+static boolean BUTTON_sample(void)
+{
+	uint8 active = (g_Button_ClickPending != 0U) ? 1U : 0U;
+	uint8 counting = 0;
+	uint8 head = g_Button_EventHead;
+
+	g_Button_RefreshCount++;
+
+	for (uint8 slot = 0; slot < BUTTON_CONFIGURED_PORTS; slot++)
 	{
-		g_Released_Count++;
-		g_Pressed_Count = 0;
+		const Button_PortConfigType* config = &Button_Ports[slot];
+		Button_PortStateType*		 port = &g_Button_PortState[slot];
+		uint8						 skipped = 0;
+
+		/* Pins with a sample divider that are not sampled by this refresh */
+		if (0U != (g_Button_RefreshCount & 1U))
+		{
+			skipped = config->Divider[0] | config->Divider[1] | config->Divider[2];
+		}
+		else if (0U != (g_Button_RefreshCount & 2U))
+		{
+			skipped = config->Divider[1] | config->Divider[2];
+		}
+		else if (0U != (g_Button_RefreshCount & 4U))
+		{
+			skipped = config->Divider[2];
+		}
+
+		/* One read for all the buttons of the port, 1 means pressed */
+		uint8 sample = (uint8)Dio_ReadPort(config->Dio_Port) ^ config->Active_Low;
+		uint8 sampled = config->Pins & (uint8)(~skipped);
+
+		/* Sampled pins that differ from their debounced state and sampled pins that do not */
+		uint8 delta = (sample ^ port->Pressed) & sampled;
+		uint8 equal = sampled & (uint8)(~delta);
+
+		/* Increment the counters of the differing pins (ripple carry over the 3 planes) */
+		uint8 carry0 = port->Count[0] & delta;
+		uint8 carry1 = port->Count[1] & carry0;
+		port->Count[0] ^= delta;
+		port->Count[1] ^= carry0;
+		port->Count[2] ^= carry1;
+
+		/* Pins whose counter reached their debounce samples take the new state */
+		uint8 mismatch = (port->Count[0] ^ config->Limit[0]) | (port->Count[1] ^ config->Limit[1]) |
+						 (port->Count[2] ^ config->Limit[2]);
+		uint8 reached = delta & (uint8)(~mismatch);
+
+		port->Pressed ^= reached;
+		port->Changed = reached;
+
+		/* Restart the counters of the pins that took a new state or got an equal sample */
+		for (uint8 plane = 0; plane < 3U; plane++)
+		{
+			port->Count[plane] &= (uint8)(~(reached | equal));
+		}
+
+		active |= port->Pressed | port->Changed;
+		counting |= port->Count[0] | port->Count[1] | port->Count[2];
 	}
 
-	if (g_Pressed_Count == 3)
+	/* The gestures are only evaluated while a button is pressed, has just changed or has a pending click */
+	if (0U != active)
 	{
-		g_button_state = BUTTON_PRESSED;
-		g_Pressed_Count = 0;
-		g_Released_Count = 0;
+		uint32 now = Os_GetTime();
+#if (BUTTON_EDGE_TRIGGER == STD_OFF)
+		uint32 cycles = DWT_GET_CYCLES();
+#endif
+
+		for (uint8 id = 0; id < BUTTON_CONFIGURED_BUTTONS; id++)
+		{
+			const Button_PortStateType* port = &g_Button_PortState[Button_Instances[id].Slot];
+			uint8						mask = Button_Instances[id].Mask;
+
+#if (BUTTON_EDGE_TRIGGER == STD_OFF)
+			/* No edge interrupt when polling, the latency is measured from the refresh */
+			if (0U != (port->Changed & mask))
+			{
+				g_Button_EdgeCycles[id] = cycles;
+			}
+#endif
+			BUTTON_updateGestures(id, (0U != (port->Pressed & mask)), (0U != (port->Changed & mask)), now);
+		}
 	}
-	else if (g_Released_Count == 3)
+
+	if (head != g_Button_EventHead)
 	{
-		g_button_state = BUTTON_RELEASED;
-		g_Released_Count = 0;
-		g_Pressed_Count = 0;
+		BUTTON_EVENT_NOTIFICATION();
 	}
+
+	return (0U != counting) ? TRUE : FALSE;
 }
+
 /*******************************************************************************************************************/
+void BUTTON_init(void)
+{
+	for (uint8 slot = 0; slot < BUTTON_CONFIGURED_PORTS; slot++)
+	{
+		const Button_PortConfigType* config = &Button_Ports[slot];
+
+		/* A button held at start up is pressed without a press event */
+		g_Button_PortState[slot].Pressed =
+			((uint8)Dio_ReadPort(config->Dio_Port) ^ config->Active_Low) & config->Pins;
+	}
+
+#if (BUTTON_EDGE_TRIGGER == STD_ON)
+	Gpt_EnableNotification(BUTTON_GPT_CHANNEL);
+
+	for (uint8 id = 0; id < BUTTON_CONFIGURED_BUTTONS; id++)
+	{
+		Icu_ChannelType channel = Button_Instances[id].Icu_Channel;
+
+		Icu_SetActivationCondition(channel, ICU_BOTH_EDGES);
+		Icu_EnableNotification(channel);
+		Icu_EnableEdgeDetection(channel);
+		g_Button_EdgeArmed |= (uint32)1U << id;
+	}
+#endif
+}
+
+/*******************************************************************************************************************/
+void BUTTON_reportAction(const Button_EventType* Event)
+{
+	if (NULL_PTR != Event)
+	{
+		uint32 cycles = DWT_GET_CYCLES() - Event->Edge_Cycles;
+
+		g_Button_Latency.Last_Cycles = cycles;
+		g_Button_Latency.Count++;
+
+		if (cycles > g_Button_Latency.Max_Cycles)
+		{
+			g_Button_Latency.Max_Cycles = cycles;
+		}
+	}
+}
+
+/*******************************************************************************************************************/
+const Button_LatencyType* BUTTON_getLatency(void)
+{
+	return &g_Button_Latency;
+}
+
+#if (BUTTON_EDGE_TRIGGER == STD_ON)
+/*******************************************************************************************************************/
+void BUTTON_edgeNotification(Icu_ChannelType Channel)
+{
+	for (uint8 id = 0; id < BUTTON_CONFIGURED_BUTTONS; id++)
+	{
+		if (Channel == Button_Instances[id].Icu_Channel)
+		{
+			/* The bounces of the pin are ignored until the sampling finds it settled */
+			Icu_DisableEdgeDetection(Channel);
+			g_Button_EdgeArmed &= ~((uint32)1U << id);
+			g_Button_EdgeCycles[id] = Icu_GetEdgeTimestamp(Channel);
+		}
+	}
+
+	/* The debounce window starts from the edge, a running gesture period is cut short */
+	Gpt_StopTimer(BUTTON_GPT_CHANNEL);
+	Gpt_StartTimer(BUTTON_GPT_CHANNEL, GPT_US_TO_TICKS(BUTTON_SAMPLE_PERIOD_US));
+}
+
+/*******************************************************************************************************************/
+void BUTTON_sampleNotification(void)
+{
+	if (TRUE == BUTTON_sample())
+	{
+		/* Debounce window still running */
+		Gpt_StartTimer(BUTTON_GPT_CHANNEL, GPT_US_TO_TICKS(BUTTON_SAMPLE_PERIOD_US));
+	}
+	else
+	{
+		uint8 pressed = 0;
+		uint8 moved = 0;
+
+		/* All the pins are settled, arm the edges of the buttons for their next change */
+		for (uint8 id = 0; id < BUTTON_CONFIGURED_BUTTONS; id++)
+		{
+			uint32 bit = (uint32)1U << id;
+
+			if (0U == (g_Button_EdgeArmed & bit))
+			{
+				Icu_EnableEdgeDetection(Button_Instances[id].Icu_Channel);
+				g_Button_EdgeArmed |= bit;
+			}
+		}
+
+		/* Enabling the edge detection drops the edges seen since the sample, check the levels again */
+		for (uint8 slot = 0; slot < BUTTON_CONFIGURED_PORTS; slot++)
+		{
+			const Button_PortConfigType* config = &Button_Ports[slot];
+			uint8 level = ((uint8)Dio_ReadPort(config->Dio_Port) ^ config->Active_Low) & config->Pins;
+
+			moved |= level ^ g_Button_PortState[slot].Pressed;
+			pressed |= g_Button_PortState[slot].Pressed;
+		}
+
+		if (0U != moved)
+		{
+			Gpt_StartTimer(BUTTON_GPT_CHANNEL, GPT_US_TO_TICKS(BUTTON_SAMPLE_PERIOD_US));
+		}
+		else if ((0U != pressed) || (0U != g_Button_ClickPending))
+		{
+			/* Long-press, repeat and double-click timings need the gesture refresh */
+			Gpt_StartTimer(BUTTON_GPT_CHANNEL, GPT_US_TO_TICKS(BUTTON_GESTURE_PERIOD_US));
+		}
+		else
+		{
+			/* Idle: no interrupt and no sampling until the next edge */
+		}
+	}
+}
+#endif
+
+/*******************************************************************************************************************/
+void BUTTON_refreshState(void)
+{
+#if (BUTTON_EDGE_TRIGGER == STD_OFF)
+	(void)BUTTON_sample();
+#endif
+}
+/*******************************************************************************************************************/
\ No newline at end of file
@@ -12,18 +12,80 @@
 #define BUTTON_H
 
 #include "Std_Types.h"
+#include "Button_Cfg.h"
 
-/* Button State according to its configuration PULL UP/Down */
+/* Button State */
 #define BUTTON_PRESSED	STD_LOW
 #define BUTTON_RELEASED STD_HIGH
 
-/* Description: Read the Button state Pressed/Released */
-uint8 BUTTON_getState(void);
+/* Gestures reported in the event queue */
+typedef enum
+{
+	BUTTON_EVENT_PRESSED,
+	BUTTON_EVENT_RELEASED,
+	BUTTON_EVENT_CLICK,		   /* short press without a second one within BUTTON_DOUBLE_CLICK_TIME_MS */
+	BUTTON_EVENT_DOUBLE_CLICK, /* short press begun within BUTTON_DOUBLE_CLICK_TIME_MS of a click, on release */
+	BUTTON_EVENT_LONG_PRESS,   /* held for BUTTON_LONG_PRESS_TIME_MS */
+	BUTTON_EVENT_REPEAT		   /* every BUTTON_REPEAT_PERIOD_MS while held after the long-press */
+} Button_EventKindType;
+
+/* One entry of the event queue */
+typedef struct
+{
+	uint32				 Timestamp;	  /* Os_GetTime() of the refresh that detected the event */
+	uint32				 Edge_Cycles; /* DWT cycles at the edge (refresh when polling) of the change */
+	uint8				 ButtonId;
+	Button_EventKindType Kind;
+} Button_EventType;
+
+/* Latency from the edge of a button to the action taken on its event, in DWT cycles (16 per us) */
+typedef struct
+{
+	uint32 Last_Cycles;
+	uint32 Max_Cycles;
+	uint32 Count; /* number of reported actions */
+} Button_LatencyType;
+
+/*
+ * Description: Initialize the debounced state from the current pin levels. In edge trigger mode the
+ *              Icu edge interrupts of the buttons and the Gpt notification are enabled, Icu_Init and
+ *              Gpt_Init must be called before.
+ */
+void BUTTON_init(void);
+
+/* Description: Read the state Pressed/Released of the button ButtonId (ButtonConf_xxx_ID) */
+uint8 BUTTON_getState(uint8 ButtonId);
+
+/* Description: Read the pressed buttons of a port slot, bit n is set if the button on pin n is pressed */
+uint8 BUTTON_getPressedMask(uint8 PortSlot);
+
+/* Description: Read the pins of a port slot whose button changed state on the last refresh */
+uint8 BUTTON_getChangedMask(uint8 PortSlot);
+
+/* Description: Remove the oldest event from the queue, returns E_NOT_OK if the queue is empty */
+Std_ReturnType BUTTON_getEvent(Button_EventType* Event);
+
+/* Description: Record the latency from the edge of Event to now, called right after the action */
+void BUTTON_reportAction(const Button_EventType* Event);
+
+/* Description: Read the latency of the reported actions */
+const Button_LatencyType* BUTTON_getLatency(void);
+
+#if (BUTTON_EDGE_TRIGGER == STD_ON)
+/* Description: Icu notification of the button channels, starts the debounce window */
+void BUTTON_edgeNotification(Icu_ChannelType Channel);
+
+/* Description: Gpt notification of BUTTON_GPT_CHANNEL, samples the buttons */
+void BUTTON_sampleNotification(void);
+#endif
 
 /* 
  * Description: This function is called every 20ms by Os Task and it responsible for Updating 
- *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
- *		and it should be in a RELEASED State if the button is released for 60ms.
+ *              the state of all the buttons. A button takes a new state after DEBOUNCE_SAMPLES
+ *              consecutive samples, it is sampled every SAMPLE_DIVIDER calls.
+ *              Every port slot is read once and all its buttons are debounced together.
+ *              The gestures of the buttons are then pushed to the event queue.
+ *              It does nothing in edge trigger mode, BUTTON_sampleNotification does the sampling.
  */
 void BUTTON_refreshState(void);
 
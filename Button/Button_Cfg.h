@@ -12,11 +12,74 @@
 #define BUTTON_CFG_H
 
 #include "Dio.h"
+#include "Icu.h"
+#include "Gpt.h"
 
-/* Set the Button Port */
-#define BUTTON_PORT	   DioConf_SW1_PORT_NUM
+/* Number of DIO ports that have buttons, every port is read once per refresh */
+#define BUTTON_CONFIGURED_PORTS			(1U)
 
-/* Set the Button Pin Number */
-#define BUTTON_PIN_NUM DioConf_SW1_CHANNEL_NUM
+/* DIO port of every port slot */
+#define ButtonConf_PORT0_DIO_PORT		DioConf_SW1_PORT_NUM
+
+/* Number of configured buttons */
+#define BUTTON_CONFIGURED_BUTTONS		(2U)
+
+/* Button Index in the instances table */
+#define ButtonConf_SW1_ID				(uint8)0
+#define ButtonConf_SW2_ID				(uint8)1
+
+/* Port slot of every button */
+#define ButtonConf_SW1_PORT_SLOT		(uint8)0
+#define ButtonConf_SW2_PORT_SLOT		(uint8)0
+
+/* Pin number of every button in its port */
+#define ButtonConf_SW1_PIN_NUM			DioConf_SW1_CHANNEL_NUM
+#define ButtonConf_SW2_PIN_NUM			DioConf_SW2_CHANNEL_NUM
+
+/* Number of consecutive samples (1 to 7) before the button takes a new state */
+#define ButtonConf_SW1_DEBOUNCE_SAMPLES	(3U)
+#define ButtonConf_SW2_DEBOUNCE_SAMPLES	(3U)
+
+/* Icu channel raising the edge interrupt of every button (edge trigger mode) */
+#define ButtonConf_SW1_ICU_CHANNEL		IcuConf_SW1_CHANNEL_ID_INDEX
+#define ButtonConf_SW2_ICU_CHANNEL		IcuConf_SW2_CHANNEL_ID_INDEX
+
+/* Pin level when the button is pressed */
+#define ButtonConf_SW1_ACTIVE_LEVEL		STD_LOW /* Pull up switch */
+#define ButtonConf_SW2_ACTIVE_LEVEL		STD_LOW /* Pull up switch */
+
+/* The button is sampled every SAMPLE_DIVIDER refreshes (1, 2, 4 or 8) */
+#define ButtonConf_SW1_SAMPLE_DIVIDER	(1U)
+#define ButtonConf_SW2_SAMPLE_DIVIDER	(1U)
+
+/*
+ * STD_ON : the buttons are idle until an Icu edge interrupt, the edge starts the one-shot Gpt
+ *          channel that samples the port every BUTTON_SAMPLE_PERIOD_US until the buttons are
+ *          settled, then every BUTTON_GESTURE_PERIOD_US while a gesture is in progress.
+ *          BUTTON_refreshState does nothing.
+ * STD_OFF: the buttons are sampled by BUTTON_refreshState (Button_Task).
+ */
+#define BUTTON_EDGE_TRIGGER				STD_ON
+
+/* Gpt channel of the sampling timer and its periods (edge trigger mode) */
+#define BUTTON_GPT_CHANNEL				GptConf_BUTTON_CHANNEL_ID_INDEX
+#define BUTTON_SAMPLE_PERIOD_US			(5000U)	 /* debounce window = DEBOUNCE_SAMPLES periods */
+#define BUTTON_GESTURE_PERIOD_US		(20000U) /* while pressed or waiting for a double-click */
+
+/* Called with the event queue not empty, after the refresh or the timer that pushed the events */
+#define BUTTON_EVENT_NOTIFICATION		App_ButtonNotification
+
+/* Gesture timings in ms, timed with Os_GetTime on the debounced state: 20 ms resolution, whether the
+ * state comes from BUTTON_refreshState or from the Gpt sampling timer */
+#define BUTTON_LONG_PRESS_TIME_MS		(1000U) /* held this long gives a long-press event */
+#define BUTTON_REPEAT_PERIOD_MS			(200U)	/* repeat events while held after the long-press */
+#define BUTTON_DOUBLE_CLICK_TIME_MS		(300U)	/* max time from a click release to the second press */
+
+/* Number of events the queue can hold (power of 2), new events are dropped when it is full */
+#define BUTTON_EVENT_QUEUE_SIZE			(16U)
+
+/* Configured buttons listed as BUTTON(ARG, <button>), used to build the instances and the
+ * per-port masks in Button.c, ARG is passed through */
+#define BUTTON_BUTTONS(BUTTON, ARG)		BUTTON(ARG, SW1) BUTTON(ARG, SW2)
 
 #endif /* BUTTON_CFG_H */
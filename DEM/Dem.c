@@ -0,0 +1,718 @@
+/******************************************************************
+ * @Module   	: Dem
+ * @Title 	 	: Diagnostic Event Manager Source file
+ * @Filename 	: Dem.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	: The debouncing state of an event is one word updated with LDREX/STREX, so
+ *                the reports from the interrupts and from the tasks never block each other.
+ *                The report that qualifies a failure captures its freeze frame, everything
+ *                else is done by Dem_MainFunction in the task context.
+ ********************************************************************/
+
+#include "Dem.h"
+#include "Eep.h"
+#include "Os.h"
+
+#if (DEM_DEV_ERROR_DETECT == STD_ON)
+
+	#include "Det.h"
+
+	/* AUTOSAR Version checking between Det and Dem Modules */
+	#if ((DET_AR_MAJOR_VERSION != DEM_AR_RELEASE_MAJOR_VERSION) || \
+		 (DET_AR_MINOR_VERSION != DEM_AR_RELEASE_MINOR_VERSION) || \
+		 (DET_AR_PATCH_VERSION != DEM_AR_RELEASE_PATCH_VERSION))
+		#error "The AR version of Det.h does not match the expected version"
+	#endif
+
+#endif
+
+/* Debouncing state of an event: counter (counter based) or elapsed time (time based) as a signed
+ * 16-bit value, qualified failed status, running timer of the time-based debouncing, and failure
+ * not yet stored in the event memory */
+#define DEM_STATE_COUNTER_MASK (0x0000FFFFU)
+#define DEM_STATE_FAILED	   (0x00010000U)
+#define DEM_STATE_TIMER_FAIL   (0x00020000U)
+#define DEM_STATE_TIMER_PASS   (0x00040000U)
+#define DEM_STATE_NEW_FAILURE  (0x00080000U)
+
+#define DEM_STATE_COUNTER(STATE) ((sint32)(sint16)(uint16)((STATE) & DEM_STATE_COUNTER_MASK))
+
+/* Event memory layout tag, a blank or differently configured EEPROM is not loaded */
+#define DEM_NV_MAGIC		   (0x44454D00U + DEM_NUMBER_OF_EVENTS)
+
+/* Event memory of an event, as stored in the EEPROM */
+typedef struct
+{
+	uint16				Occurrence_Counter;
+	uint8				Status; /* DEM_UDS_STATUS_CDTC and DEM_UDS_STATUS_TFSLC */
+	uint8				Reserved;
+	Dem_FreezeFrameType Freeze_Frame;
+} Dem_NvEventType;
+
+/* Event memory, as stored in the EEPROM (a whole number of words) */
+typedef struct
+{
+	uint32			Magic;
+	uint32			Operation_Cycle;
+	Dem_NvEventType Events[DEM_NUMBER_OF_EVENTS];
+} Dem_NvBlockType;
+
+STATIC const Dem_ConfigEvent* Dem_Events = NULL_PTR;
+STATIC uint8				  Dem_Status = DEM_NOT_INITIALIZED;
+
+/* Debouncing state of every event and freeze frame of its last qualified failure, not yet stored */
+STATIC volatile uint32				Dem_EventState[DEM_NUMBER_OF_EVENTS];
+STATIC volatile Dem_FreezeFrameType Dem_FailureFrame[DEM_NUMBER_OF_EVENTS];
+
+/* Event memory in RAM and copy being written by the EEPROM job */
+STATIC Dem_NvBlockType Dem_NvImage;
+STATIC Dem_NvBlockType Dem_NvBuffer;
+
+/* The RAM event memory differs from the EEPROM, a write job is running, time since the last write */
+STATIC boolean Dem_NvDirty = FALSE;
+STATIC boolean Dem_NvWriting = FALSE;
+STATIC uint32  Dem_NvFlushTimer = 0U;
+
+/************************************************************************************
+* Function Name		: Dem_Qualify
+* Description		: Returns State with the qualified status Failed, a new failure is marked
+*					  for Dem_MainFunction. The timers of the time-based debouncing are stopped.
+************************************************************************************/
+STATIC uint32 Dem_Qualify(uint32 State, boolean Failed)
+{
+	uint32 NewState = State & ~(DEM_STATE_TIMER_FAIL | DEM_STATE_TIMER_PASS);
+
+	if (FALSE == Failed)
+	{
+		NewState &= ~DEM_STATE_FAILED;
+	}
+	else if (0U == (State & DEM_STATE_FAILED))
+	{
+		NewState |= DEM_STATE_FAILED | DEM_STATE_NEW_FAILURE;
+	}
+	else
+	{
+		/* No Action Required ... already failed */
+	}
+
+	return NewState;
+}
+
+/************************************************************************************
+* Function Name		: Dem_SetCounter
+* Description		: Returns State with the debounce counter Counter, limited to the thresholds
+*					  of the event, and qualified when a threshold is reached.
+************************************************************************************/
+STATIC uint32 Dem_SetCounter(const Dem_ConfigEvent* Event, uint32 State, sint32 Counter)
+{
+	uint32 NewState = State;
+
+	if (Counter >= Event->Fail_Threshold)
+	{
+		Counter = Event->Fail_Threshold;
+		NewState = Dem_Qualify(NewState, TRUE);
+	}
+	else if (Counter <= Event->Pass_Threshold)
+	{
+		Counter = Event->Pass_Threshold;
+		NewState = Dem_Qualify(NewState, FALSE);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return (NewState & ~DEM_STATE_COUNTER_MASK) | ((uint32)Counter & DEM_STATE_COUNTER_MASK);
+}
+
+/************************************************************************************
+* Function Name		: Dem_Debounce
+* Description		: Returns the debouncing state of an event after the report EventStatus.
+*					  A counter jumps to 0 when the reports change direction.
+************************************************************************************/
+STATIC uint32 Dem_Debounce(const Dem_ConfigEvent* Event, uint32 State, Dem_EventStatusType EventStatus)
+{
+	uint32 NewState = State;
+	sint32 Counter = DEM_STATE_COUNTER(State);
+
+	if (DEM_EVENT_STATUS_FAILED == EventStatus)
+	{
+		NewState = Dem_SetCounter(Event, State, Event->Fail_Threshold);
+	}
+	else if (DEM_EVENT_STATUS_PASSED == EventStatus)
+	{
+		NewState = Dem_SetCounter(Event, State, Event->Pass_Threshold);
+	}
+	else if (DEM_DEBOUNCE_COUNTER_BASED == Event->Debounce)
+	{
+		if (DEM_EVENT_STATUS_PREFAILED == EventStatus)
+		{
+			NewState = Dem_SetCounter(Event, State, ((Counter < 0) ? 0 : Counter) + (sint32)Event->Inc_Step);
+		}
+		else
+		{
+			NewState = Dem_SetCounter(Event, State, ((Counter > 0) ? 0 : Counter) - (sint32)Event->Dec_Step);
+		}
+	}
+	else if (DEM_EVENT_STATUS_PREFAILED == EventStatus)
+	{
+		/* Start the failed timer unless it runs or the event already failed without a passed timer */
+		if ((0U == (State & DEM_STATE_TIMER_FAIL)) &&
+			((0U == (State & DEM_STATE_FAILED)) || (0U != (State & DEM_STATE_TIMER_PASS))))
+		{
+			NewState = (State & ~(DEM_STATE_COUNTER_MASK | DEM_STATE_TIMER_PASS)) | DEM_STATE_TIMER_FAIL;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* Start the passed timer unless it runs or the event already passed without a failed timer */
+		if ((0U == (State & DEM_STATE_TIMER_PASS)) &&
+			((0U != (State & DEM_STATE_FAILED)) || (0U != (State & DEM_STATE_TIMER_FAIL))))
+		{
+			NewState = (State & ~(DEM_STATE_COUNTER_MASK | DEM_STATE_TIMER_FAIL)) | DEM_STATE_TIMER_PASS;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+
+	return NewState;
+}
+
+/************************************************************************************
+* Function Name		: Dem_TimerTick
+* Description		: Returns the state of a time-based event one task period later.
+************************************************************************************/
+STATIC uint32 Dem_TimerTick(const Dem_ConfigEvent* Event, uint32 State)
+{
+	uint32 NewState = State;
+	sint32 Counter = DEM_STATE_COUNTER(State);
+
+	if (0U != (State & DEM_STATE_TIMER_FAIL))
+	{
+		NewState = Dem_SetCounter(Event, State, Counter + (sint32)DEM_TASK_PERIOD_MS);
+	}
+	else if (0U != (State & DEM_STATE_TIMER_PASS))
+	{
+		NewState = Dem_SetCounter(Event, State, Counter - (sint32)DEM_TASK_PERIOD_MS);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return NewState;
+}
+
+/************************************************************************************
+* Function Name		: Dem_CaptureFailure
+* Description		: Takes the freeze frame of an event in the context that qualified its
+*					  failure, Dem_MainFunction only stores it.
+************************************************************************************/
+STATIC void Dem_CaptureFailure(Dem_EventIdType EventId)
+{
+	volatile Dem_FreezeFrameType* Frame = &Dem_FailureFrame[EventId];
+
+	Frame->Time_Ms = DEM_GET_TIME_MS();
+	Frame->Operation_Cycle = Dem_NvImage.Operation_Cycle;
+	Frame->Data = (NULL_PTR != Dem_Events[EventId].Capture) ? Dem_Events[EventId].Capture() : 0U;
+}
+
+/************************************************************************************
+* Function Name		: Dem_TakeNewFailure
+* Description		: Clears the new failure mark of an event and returns whether it was set.
+************************************************************************************/
+STATIC boolean Dem_TakeNewFailure(Dem_EventIdType EventId)
+{
+	uint32 State;
+
+	do
+	{
+		State = LOAD_EXCLUSIVE(&Dem_EventState[EventId]);
+	} while (0U != STORE_EXCLUSIVE(State & ~DEM_STATE_NEW_FAILURE, &Dem_EventState[EventId]));
+
+	return (0U != (State & DEM_STATE_NEW_FAILURE)) ? TRUE : FALSE;
+}
+
+/************************************************************************************
+* Function Name		: Dem_StoreFailure
+* Description		: Counts the new failure of an event in the event memory and stores the
+*					  freeze frame captured when it was qualified.
+************************************************************************************/
+STATIC void Dem_StoreFailure(Dem_EventIdType EventId)
+{
+	Dem_NvEventType* Memory = &Dem_NvImage.Events[EventId];
+
+	if (Memory->Occurrence_Counter < 0xFFFFU)
+	{
+		Memory->Occurrence_Counter++;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	Memory->Status |= DEM_UDS_STATUS_CDTC | DEM_UDS_STATUS_TFSLC;
+	Memory->Freeze_Frame = Dem_FailureFrame[EventId];
+
+	Dem_NvDirty = TRUE;
+}
+
+/************************************************************************************
+* Function Name		: Dem_FlushNv
+* Description		: Writes the event memory to the EEPROM when it changed and the last write is
+*					  at least DEM_NV_FLUSH_PERIOD_MS old. The memory is copied, so that the events
+*					  can go on changing it during the job, and the EEPROM driver only programs
+*					  the words that differ.
+************************************************************************************/
+STATIC void Dem_FlushNv(void)
+{
+	if (Dem_NvFlushTimer < DEM_NV_FLUSH_PERIOD_MS)
+	{
+		Dem_NvFlushTimer += DEM_TASK_PERIOD_MS;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if ((TRUE == Dem_NvWriting) && (EEP_BUSY != Eep_GetStatus()))
+	{
+		/* A failed job is written again with the next batch */
+		Dem_NvWriting = FALSE;
+
+		if (EEP_JOB_OK != Eep_GetJobResult())
+		{
+			Dem_NvDirty = TRUE;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if ((TRUE == Dem_NvDirty) && (FALSE == Dem_NvWriting) && (EEP_IDLE == Eep_GetStatus()) &&
+		(Dem_NvFlushTimer >= DEM_NV_FLUSH_PERIOD_MS))
+	{
+		Dem_NvBuffer = Dem_NvImage;
+
+		if (E_OK == Eep_Write(DEM_NV_EEP_ADDRESS, (const uint32*)&Dem_NvBuffer, sizeof(Dem_NvBuffer)))
+		{
+			Dem_NvDirty = FALSE;
+			Dem_NvWriting = TRUE;
+			Dem_NvFlushTimer = 0U;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+#if (DEM_DEV_ERROR_DETECT == STD_ON)
+/************************************************************************************
+* Function Name		: Dem_CheckEvent
+* Description		: Reports the DET error of a call before Dem_Init, with an invalid event or
+*					  with a NULL pointer, and returns E_NOT_OK for it.
+************************************************************************************/
+STATIC Std_ReturnType Dem_CheckEvent(uint8 ApiId, Dem_EventIdType EventId, const void* Pointer)
+{
+	uint8 ErrorId = 0U;
+
+	if (DEM_NOT_INITIALIZED == Dem_Status)
+	{
+		ErrorId = DEM_E_UNINIT;
+	}
+	else if (DEM_NUMBER_OF_EVENTS <= EventId)
+	{
+		ErrorId = DEM_E_PARAM_DATA;
+	}
+	else if (NULL_PTR == Pointer)
+	{
+		ErrorId = DEM_E_PARAM_POINTER;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if (0U != ErrorId)
+	{
+		Det_ReportError(DEM_MODULE_ID, DEM_INSTANCE_ID, ApiId, ErrorId);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return (0U != ErrorId) ? E_NOT_OK : E_OK;
+}
+#endif
+
+/************************************************************************************
+ * Service name      : Dem_Init
+*  Syntax            : void Dem_Init(const Dem_ConfigType* ConfigPtr)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x02
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : ConfigPtr - Pointer to post-build configuration data
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to Initialize the Dem: the event memory is read from the EEPROM
+*                      (cleared if it is blank or of another layout), the operation cycle counter
+*                      is incremented and all the events start passed.
+ ************************************************************************************/
+void Dem_Init(const Dem_ConfigType* ConfigPtr)
+{
+	/* The event memory is written to the EEPROM as words */
+	STATIC_ASSERT_EXPR((sizeof(Dem_NvBlockType) % 4U) == 0U);
+	STATIC_ASSERT_EXPR((DEM_NV_EEP_ADDRESS + sizeof(Dem_NvBlockType)) <= EEP_SIZE);
+
+#if (DEM_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(DEM_MODULE_ID, DEM_INSTANCE_ID, DEM_INIT_SID, DEM_E_PARAM_CONFIG);
+	}
+	else
+#endif
+	{
+		Dem_Events = ConfigPtr->Events;
+
+		for (Dem_EventIdType EventId = 0U; EventId < DEM_NUMBER_OF_EVENTS; EventId++)
+		{
+			Dem_EventState[EventId] = 0U;
+			Dem_FailureFrame[EventId] = (Dem_FreezeFrameType){0U};
+		}
+
+		if ((E_OK != Eep_Read(DEM_NV_EEP_ADDRESS, (uint32*)&Dem_NvImage, sizeof(Dem_NvImage))) ||
+			(DEM_NV_MAGIC != Dem_NvImage.Magic))
+		{
+			Dem_NvImage = (Dem_NvBlockType){.Magic = DEM_NV_MAGIC};
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		Dem_NvImage.Operation_Cycle++;
+
+		/* The new operation cycle is written at the first Dem_MainFunction */
+		Dem_NvDirty = TRUE;
+		Dem_NvWriting = FALSE;
+		Dem_NvFlushTimer = DEM_NV_FLUSH_PERIOD_MS;
+
+		Dem_Status = DEM_INITIALIZED;
+	}
+}
+
+/************************************************************************************
+ * Service name      : Dem_SetEventStatus
+*  Syntax            : Std_ReturnType Dem_SetEventStatus(Dem_EventIdType EventId,
+*                                                        Dem_EventStatusType EventStatus)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x04
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : EventId - DemConf_xxx_EVENT_ID
+*                      EventStatus - DEM_EVENT_STATUS_xxx result of the test
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : Std_ReturnType - E_NOT_OK for an invalid request
+*  Description       : Function to report the result of the test of an event. The debouncing is
+*                      retried if another report of the event interrupted it, the report that
+*                      qualifies a failure captures its freeze frame and Dem_MainFunction stores
+*                      it later.
+ ************************************************************************************/
+Std_ReturnType Dem_SetEventStatus(Dem_EventIdType EventId, Dem_EventStatusType EventStatus)
+{
+	Std_ReturnType Status = E_OK;
+
+#if (DEM_DEV_ERROR_DETECT == STD_ON)
+	Status = Dem_CheckEvent(DEM_SET_EVENT_STATUS_SID, EventId, &EventStatus);
+
+	if ((E_OK == Status) && (DEM_EVENT_STATUS_PREFAILED < EventStatus))
+	{
+		Det_ReportError(DEM_MODULE_ID, DEM_INSTANCE_ID, DEM_SET_EVENT_STATUS_SID, DEM_E_PARAM_DATA);
+		Status = E_NOT_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if (E_OK == Status)
+	{
+		uint32 State;
+		uint32 NewState;
+
+		do
+		{
+			State = LOAD_EXCLUSIVE(&Dem_EventState[EventId]);
+			NewState = Dem_Debounce(&Dem_Events[EventId], State, EventStatus);
+		} while (0U != STORE_EXCLUSIVE(NewState, &Dem_EventState[EventId]));
+
+		/* Only the report that qualified the failure captures it */
+		if ((0U != (NewState & DEM_STATE_FAILED)) && (0U == (State & DEM_STATE_FAILED)))
+		{
+			Dem_CaptureFailure(EventId);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+/************************************************************************************
+ * Service name      : Dem_GetEventStatus
+*  Syntax            : Std_ReturnType Dem_GetEventStatus(Dem_EventIdType EventId,
+*                                                        Dem_UdsStatusByteType* EventStatusByte)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x0A
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : EventId - DemConf_xxx_EVENT_ID
+*  Parameters (inout): None
+*  Parameters (out)  : EventStatusByte - DEM_UDS_STATUS_xxx bits of the event
+*  Return value      : Std_ReturnType - E_NOT_OK for an invalid request
+*  Description       : Function to read the status of an event.
+ ************************************************************************************/
+Std_ReturnType Dem_GetEventStatus(Dem_EventIdType EventId, Dem_UdsStatusByteType* EventStatusByte)
+{
+	Std_ReturnType Status = E_OK;
+
+#if (DEM_DEV_ERROR_DETECT == STD_ON)
+	Status = Dem_CheckEvent(DEM_GET_EVENT_STATUS_SID, EventId, EventStatusByte);
+#endif
+
+	if (E_OK == Status)
+	{
+		*EventStatusByte = Dem_NvImage.Events[EventId].Status;
+
+		if (0U != (Dem_EventState[EventId] & DEM_STATE_FAILED))
+		{
+			*EventStatusByte |= DEM_UDS_STATUS_TF;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Dem_GetOccurrenceCounter(Dem_EventIdType EventId, uint16* OccurrenceCounter)
+{
+	Std_ReturnType Status = E_OK;
+
+#if (DEM_DEV_ERROR_DETECT == STD_ON)
+	Status = Dem_CheckEvent(DEM_GET_OCCURRENCE_SID, EventId, OccurrenceCounter);
+#endif
+
+	if (E_OK == Status)
+	{
+		*OccurrenceCounter = Dem_NvImage.Events[EventId].Occurrence_Counter;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Dem_GetFreezeFrame(Dem_EventIdType EventId, Dem_FreezeFrameType* FreezeFrame)
+{
+	Std_ReturnType Status = E_OK;
+
+#if (DEM_DEV_ERROR_DETECT == STD_ON)
+	Status = Dem_CheckEvent(DEM_GET_FREEZE_FRAME_SID, EventId, FreezeFrame);
+#endif
+
+	if ((E_OK == Status) && (0U != Dem_NvImage.Events[EventId].Occurrence_Counter))
+	{
+		*FreezeFrame = Dem_NvImage.Events[EventId].Freeze_Frame;
+	}
+	else
+	{
+		Status = E_NOT_OK;
+	}
+
+	return Status;
+}
+
+/************************************************************************************
+ * Service name      : Dem_ClearEvents
+*  Syntax            : void Dem_ClearEvents(void)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x23
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to clear the counters, status and freeze frames of all the events
+*                      and to restart their debouncing, the operation cycle counter is kept.
+ ************************************************************************************/
+void Dem_ClearEvents(void)
+{
+#if (DEM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Module is initialized before using this function */
+	if (DEM_NOT_INITIALIZED == Dem_Status)
+	{
+		Det_ReportError(DEM_MODULE_ID, DEM_INSTANCE_ID, DEM_CLEAR_EVENTS_SID, DEM_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for (Dem_EventIdType EventId = 0U; EventId < DEM_NUMBER_OF_EVENTS; EventId++)
+		{
+			Dem_EventState[EventId] = 0U;
+			Dem_NvImage.Events[EventId] = (Dem_NvEventType){0U};
+		}
+
+		Dem_NvDirty = TRUE;
+	}
+}
+
+/************************************************************************************
+ * Service name      : Dem_MainFunction
+*  Syntax            : void Dem_MainFunction(void)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x55
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to step the time-based debouncing, store the new failures and
+*                      their freeze frames in the event memory and start its write to the EEPROM
+*                      (Eep_MainFunction does the programming).
+ ************************************************************************************/
+void Dem_MainFunction(void)
+{
+#if (DEM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Module is initialized before using this function */
+	if (DEM_NOT_INITIALIZED == Dem_Status)
+	{
+		Det_ReportError(DEM_MODULE_ID, DEM_INSTANCE_ID, DEM_MAIN_FUNCTION_SID, DEM_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for (Dem_EventIdType EventId = 0U; EventId < DEM_NUMBER_OF_EVENTS; EventId++)
+		{
+			if (DEM_DEBOUNCE_TIME_BASED == Dem_Events[EventId].Debounce)
+			{
+				uint32 State;
+				uint32 NewState;
+
+				do
+				{
+					State = LOAD_EXCLUSIVE(&Dem_EventState[EventId]);
+					NewState = Dem_TimerTick(&Dem_Events[EventId], State);
+				} while (0U != STORE_EXCLUSIVE(NewState, &Dem_EventState[EventId]));
+
+				/* A threshold reached by the timer qualifies the failure here */
+				if ((0U != (NewState & DEM_STATE_FAILED)) && (0U == (State & DEM_STATE_FAILED)))
+				{
+					Dem_CaptureFailure(EventId);
+				}
+				else
+				{
+					/* No Action Required */
+				}
+			}
+			else
+			{
+				/* No Action Required */
+			}
+
+			if (TRUE == Dem_TakeNewFailure(EventId))
+			{
+				Dem_StoreFailure(EventId);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		Dem_FlushNv();
+	}
+}
+
+/************************************************************************************
+*  Service name      : Dem_GetVersionInfo
+*  Syntax            : void Dem_GetVersionInfo(Std_VersionInfoType* versioninfo )
+*  Mode              : User Mode (Non-Privileged Mode)
+*  Service ID[hex]   : 0x00
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : versioninfo - Pointer to where to store the version
+*                      information of this module.
+*  Return value      : None
+*  Description       : Service to get the version information of this module
+ ************************************************************************************/
+#if (DEM_VERSION_INFO_API == STD_ON)
+void Dem_GetVersionInfo(Std_VersionInfoType* versioninfo)
+{
+	#if (DEM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(DEM_MODULE_ID, DEM_INSTANCE_ID, DEM_GET_VERSION_INFO_SID, DEM_E_PARAM_POINTER);
+	}
+	else
+	#endif /* (DEM_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)DEM_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)DEM_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)DEM_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)DEM_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)DEM_SW_PATCH_VERSION;
+	}
+}
+#endif
@@ -0,0 +1,220 @@
+/******************************************************************
+ * @Module   	: Dem
+ * @Title 	 	: Diagnostic Event Manager Header File
+ * @Filename 	: Dem.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: The events are debounced in RAM, the event memory (occurrence counters,
+ *                status and freeze frames) is written to the EEPROM by Dem_MainFunction
+ *                in batches of at most one every DEM_NV_FLUSH_PERIOD_MS.
+ ********************************************************************/
+
+#ifndef DEM_H
+#define DEM_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define DEM_VENDOR_ID				 (1000U)
+
+/* Dem Module Id */
+#define DEM_MODULE_ID				 (54U)
+
+/* Dem Instance Id */
+#define DEM_INSTANCE_ID				 (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define DEM_SW_MAJOR_VERSION		 (1U)
+#define DEM_SW_MINOR_VERSION		 (0U)
+#define DEM_SW_PATCH_VERSION		 (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DEM_AR_RELEASE_MAJOR_VERSION (4U)
+#define DEM_AR_RELEASE_MINOR_VERSION (0U)
+#define DEM_AR_RELEASE_PATCH_VERSION (3U)
+
+/*
+ * Macros for Dem Status
+ */
+#define DEM_INITIALIZED				 (1U)
+#define DEM_NOT_INITIALIZED			 (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Dem Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != DEM_AR_RELEASE_MAJOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_MINOR_VERSION != DEM_AR_RELEASE_MINOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_PATCH_VERSION != DEM_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Dem Pre-Compile Configuration Header file */
+#include "Dem_Cfg.h"
+
+/* AUTOSAR Version checking between Dem_Cfg.h and Dem.h files */
+#if ((DEM_CFG_AR_RELEASE_MAJOR_VERSION != DEM_AR_RELEASE_MAJOR_VERSION) || \
+	 (DEM_CFG_AR_RELEASE_MINOR_VERSION != DEM_AR_RELEASE_MINOR_VERSION) || \
+	 (DEM_CFG_AR_RELEASE_PATCH_VERSION != DEM_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Dem_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Dem_Cfg.h and Dem.h files */
+#if ((DEM_CFG_SW_MAJOR_VERSION != DEM_SW_MAJOR_VERSION) || \
+	 (DEM_CFG_SW_MINOR_VERSION != DEM_SW_MINOR_VERSION) || \
+	 (DEM_CFG_SW_PATCH_VERSION != DEM_SW_PATCH_VERSION))
+	#error "The SW version of Dem_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for DEM GetVersionInfo */
+#define DEM_GET_VERSION_INFO_SID	 (uint8)0x00
+
+/* Service ID for DEM Init */
+#define DEM_INIT_SID				 (uint8)0x02
+
+/* Service ID for DEM SetEventStatus */
+#define DEM_SET_EVENT_STATUS_SID	 (uint8)0x04
+
+/* Service ID for DEM GetEventStatus */
+#define DEM_GET_EVENT_STATUS_SID	 (uint8)0x0A
+
+/* Service ID for DEM ClearEvents */
+#define DEM_CLEAR_EVENTS_SID		 (uint8)0x23
+
+/* Service ID for DEM MainFunction */
+#define DEM_MAIN_FUNCTION_SID		 (uint8)0x55
+
+/* Service ID for DEM GetOccurrenceCounter */
+#define DEM_GET_OCCURRENCE_SID		 (uint8)0x60
+
+/* Service ID for DEM GetFreezeFrame */
+#define DEM_GET_FREEZE_FRAME_SID	 (uint8)0x61
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* Dem_Init API service called with NULL pointer parameter */
+#define DEM_E_PARAM_CONFIG			 (uint8)0x10
+
+/* DET code to report that an API service is called with a NULL pointer parameter */
+#define DEM_E_PARAM_POINTER			 (uint8)0x11
+
+/* DET code to report an invalid event Id or event status */
+#define DEM_E_PARAM_DATA			 (uint8)0x12
+
+/* DET code to report that an API service is called without module initialization */
+#define DEM_E_UNINIT				 (uint8)0x20
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Dem_EventIdType, DemConf_xxx_EVENT_ID */
+typedef uint16 Dem_EventIdType;
+
+/* Type definition for Dem_EventStatusType, the result of a test reported by Dem_SetEventStatus */
+typedef uint8 Dem_EventStatusType;
+
+#define DEM_EVENT_STATUS_PASSED		 (Dem_EventStatusType)0x00 /* qualified passed */
+#define DEM_EVENT_STATUS_FAILED		 (Dem_EventStatusType)0x01 /* qualified failed */
+#define DEM_EVENT_STATUS_PREPASSED	 (Dem_EventStatusType)0x02 /* passed, to be debounced */
+#define DEM_EVENT_STATUS_PREFAILED	 (Dem_EventStatusType)0x03 /* failed, to be debounced */
+
+/* Type definition for Dem_UdsStatusByteType, status bits of an event */
+typedef uint8 Dem_UdsStatusByteType;
+
+#define DEM_UDS_STATUS_TF			 (Dem_UdsStatusByteType)0x01 /* test failed now */
+#define DEM_UDS_STATUS_CDTC			 (Dem_UdsStatusByteType)0x08 /* failure stored in the event memory */
+#define DEM_UDS_STATUS_TFSLC		 (Dem_UdsStatusByteType)0x20 /* test failed since the last clear */
+
+/* Debouncing algorithm of an event */
+typedef enum
+{
+	DEM_DEBOUNCE_COUNTER_BASED, /* the reports move a counter by Inc_Step / Dec_Step */
+	DEM_DEBOUNCE_TIME_BASED		/* a report starts a timer, the event is qualified at a threshold */
+} Dem_DebounceType;
+
+/* Function returning the application data stored in the freeze frame of an event */
+typedef uint32 (*Dem_FreezeFrameCaptureType)(void);
+
+typedef struct
+{
+	/* Member contains the debouncing algorithm of the event */
+	Dem_DebounceType Debounce;
+	/* Members contain the counter steps of a PREFAILED and of a PREPASSED report (counter based only) */
+	uint16 Inc_Step;
+	uint16 Dec_Step;
+	/* Members contain the counter (counter based) or the time in ms (time based) at which the event is
+	 * qualified failed (positive) and passed (negative) */
+	sint16 Fail_Threshold;
+	sint16 Pass_Threshold;
+	/* Member contains the function giving the data of the freeze frame (NULL_PTR for none), called by the
+	 * report that qualifies the failure, possibly from an interrupt */
+	Dem_FreezeFrameCaptureType Capture;
+} Dem_ConfigEvent;
+
+/* Data Structure required for initializing the Dem */
+typedef struct Dem_ConfigType
+{
+	Dem_ConfigEvent Events[DEM_NUMBER_OF_EVENTS];
+} Dem_ConfigType;
+
+/* Environment of the last failure of an event */
+typedef struct
+{
+	uint32 Time_Ms;			/* DEM_GET_TIME_MS() when the event was qualified failed */
+	uint32 Operation_Cycle; /* number of Dem_Init calls (power cycles) since the EEPROM was blank */
+	uint32 Data;			/* value of the Capture function of the event */
+} Dem_FreezeFrameType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for DEM Initialization API, loads the event memory from the EEPROM (Eep_Init must be called
+ * before) and starts a new operation cycle */
+void Dem_Init(const Dem_ConfigType* ConfigPtr);
+
+/* Function for DEM SetEventStatus API, debounces the report in RAM with one exclusive update of the
+ * event: it can be called from any interrupt and never waits for the EEPROM */
+Std_ReturnType Dem_SetEventStatus(Dem_EventIdType EventId, Dem_EventStatusType EventStatus);
+
+/* Function for DEM GetEventStatus API */
+Std_ReturnType Dem_GetEventStatus(Dem_EventIdType EventId, Dem_UdsStatusByteType* EventStatusByte);
+
+/* Function to read the number of failures of an event since the last clear */
+Std_ReturnType Dem_GetOccurrenceCounter(Dem_EventIdType EventId, uint16* OccurrenceCounter);
+
+/* Function to read the freeze frame of the last failure of an event, E_NOT_OK if none is stored */
+Std_ReturnType Dem_GetFreezeFrame(Dem_EventIdType EventId, Dem_FreezeFrameType* FreezeFrame);
+
+/* Function to clear the event memory, written to the EEPROM with the next batch */
+void Dem_ClearEvents(void);
+
+/* Function for DEM MainFunction API, called every DEM_TASK_PERIOD_MS from a low priority task: time-based
+ * debouncing, storage of the new failures and start of the EEPROM writes */
+void Dem_MainFunction(void);
+
+#if (DEM_VERSION_INFO_API == STD_ON)
+/* Function for DEM Get Version Info API */
+void Dem_GetVersionInfo(Std_VersionInfoType* versioninfo);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Dem and other modules */
+extern const Dem_ConfigType Dem_Configuration;
+
+#endif /* DEM_H */
@@ -0,0 +1,68 @@
+/******************************************************************
+ * @Module   	: Dem
+ * @Title 	 	: Diagnostic Event Manager Pre-Compile Configuration Header File 
+ * @Filename 	: Dem_Cfg.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: 
+ ********************************************************************/
+
+#ifndef DEM_CFG_H
+#define DEM_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define DEM_CFG_SW_MAJOR_VERSION				(1U)
+#define DEM_CFG_SW_MINOR_VERSION				(0U)
+#define DEM_CFG_SW_PATCH_VERSION				(0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DEM_CFG_AR_RELEASE_MAJOR_VERSION		(4U)
+#define DEM_CFG_AR_RELEASE_MINOR_VERSION		(0U)
+#define DEM_CFG_AR_RELEASE_PATCH_VERSION		(3U)
+
+/* Pre-compile option for Development Error Detect */
+#define DEM_DEV_ERROR_DETECT					(STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define DEM_VERSION_INFO_API					(STD_ON)
+
+/* Period of the task calling Dem_MainFunction, the step of the time-based debouncing */
+#define DEM_TASK_PERIOD_MS						(120U)
+
+/* Minimum time between two writes of the event memory to the EEPROM, the changes made meanwhile
+ * are written together */
+#define DEM_NV_FLUSH_PERIOD_MS					(10000U)
+
+/* Byte address of the event memory in the EEPROM */
+#define DEM_NV_EEP_ADDRESS						(0U)
+
+/* Time of the failures in the freeze frames, ms since start-up in steps of the 20 ms Os tick */
+#ifndef DEM_GET_TIME_MS
+	#define DEM_GET_TIME_MS() Os_GetTime()
+#endif
+
+/* Number of the configured events */
+#define DEM_NUMBER_OF_EVENTS					(2U)
+
+/* Event Id, index in the array of structures in Dem_PBcfg.c */
+#define DemConf_SW2_STUCK_EVENT_ID				(Dem_EventIdType)0
+#define DemConf_BUTTON_LATENCY_EVENT_ID			(Dem_EventIdType)1
+
+/* SW2 pressed for 10 s is stuck, it is good again after 240 ms released */
+#define DemConf_SW2_STUCK_DEBOUNCE				(Dem_DebounceType) DEM_DEBOUNCE_TIME_BASED
+#define DemConf_SW2_STUCK_FAIL_THRESHOLD		(sint16)10000
+#define DemConf_SW2_STUCK_PASS_THRESHOLD		(sint16)(-240)
+
+/* Button action later than the limit three times in a row (each in-time action counts one down) */
+#define DemConf_BUTTON_LATENCY_DEBOUNCE			(Dem_DebounceType) DEM_DEBOUNCE_COUNTER_BASED
+#define DemConf_BUTTON_LATENCY_INC_STEP			(uint16)1
+#define DemConf_BUTTON_LATENCY_DEC_STEP			(uint16)1
+#define DemConf_BUTTON_LATENCY_FAIL_THRESHOLD	(sint16)3
+#define DemConf_BUTTON_LATENCY_PASS_THRESHOLD	(sint16)(-3)
+
+#endif /* DEM_CFG_H */
@@ -0,0 +1,68 @@
+/******************************************************************
+ * @Module   	: Dem
+ * @Title 	 	: Dem Post Build Configuration Source file
+ * @Filename 	: Dem_PBcfg.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	:
+ ********************************************************************/
+
+#include "Dem.h"
+
+/* Freeze frame functions of the events */
+#include "App.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define DEM_PBCFG_SW_MAJOR_VERSION		   (1U)
+#define DEM_PBCFG_SW_MINOR_VERSION		   (0U)
+#define DEM_PBCFG_SW_PATCH_VERSION		   (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DEM_PBCFG_AR_RELEASE_MAJOR_VERSION (4U)
+#define DEM_PBCFG_AR_RELEASE_MINOR_VERSION (0U)
+#define DEM_PBCFG_AR_RELEASE_PATCH_VERSION (3U)
+
+/* AUTOSAR Version checking between Dem_PBcfg.c and Dem.h files */
+#if ((DEM_PBCFG_AR_RELEASE_MAJOR_VERSION != DEM_AR_RELEASE_MAJOR_VERSION) || \
+	 (DEM_PBCFG_AR_RELEASE_MINOR_VERSION != DEM_AR_RELEASE_MINOR_VERSION) || \
+	 (DEM_PBCFG_AR_RELEASE_PATCH_VERSION != DEM_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Dem_PBcfg.c and Dem.h files */
+#if ((DEM_PBCFG_SW_MAJOR_VERSION != DEM_SW_MAJOR_VERSION) || \
+	 (DEM_PBCFG_SW_MINOR_VERSION != DEM_SW_MINOR_VERSION) || \
+	 (DEM_PBCFG_SW_PATCH_VERSION != DEM_SW_PATCH_VERSION))
+	#error "The SW version of PBcfg.c does not match the expected version"
+#endif
+/* PB structure used with Dem_Init API */
+const Dem_ConfigType Dem_Configuration = {
+
+	.Events =
+		{
+
+			[DemConf_SW2_STUCK_EVENT_ID] =
+				{
+					.Debounce = DemConf_SW2_STUCK_DEBOUNCE,
+					.Inc_Step = 0U,
+					.Dec_Step = 0U,
+					.Fail_Threshold = DemConf_SW2_STUCK_FAIL_THRESHOLD,
+					.Pass_Threshold = DemConf_SW2_STUCK_PASS_THRESHOLD,
+					.Capture = NULL_PTR,
+				},
+			[DemConf_BUTTON_LATENCY_EVENT_ID] =
+				{
+					.Debounce = DemConf_BUTTON_LATENCY_DEBOUNCE,
+					.Inc_Step = DemConf_BUTTON_LATENCY_INC_STEP,
+					.Dec_Step = DemConf_BUTTON_LATENCY_DEC_STEP,
+					.Fail_Threshold = DemConf_BUTTON_LATENCY_FAIL_THRESHOLD,
+					.Pass_Threshold = DemConf_BUTTON_LATENCY_PASS_THRESHOLD,
+					.Capture = App_ButtonLatencyFreezeFrame,
+				},
+		},
+};
@@ -2,14 +2,32 @@
  * @Module   	: DET
  * @Title 	 	: Development Error Tracer Module Source Code
  * @Filename 	: Det.c
- * @Description : Det stores the development errors reported by other modules.
- *                This source file is a STUB for the Det Module
+ * @Description : Det stores the development errors reported by other modules in a log
+ *                of DET_LOG_SIZE records, the repeated errors are counted in their record
  * @Author 	 	: Hossam Mohamed
  * @Compiler 	: IAR 
- * @Notes    	: 
+ * @Notes    	: The log is a ring written without masking the interrupts: a report reserves
+ *                its record with an exclusive increment of the head, and publishes it by
+ *                writing its sequence number last
  ********************************************************************/
 
 #include "Det.h"
+#include "Common_Macros.h"
+#include "Dwt.h"
+
+#define DET_LOG_MASK			 (DET_LOG_SIZE - 1U)
+
+#define DET_COUNTED_MODULE(ID)	 (ID),
+
+/* One counter per module of DET_COUNTED_MODULES and a last one for all the other modules */
+#define DET_NUMBER_OF_COUNTERS	 ((sizeof(Det_CountedModules) / sizeof(Det_CountedModules[0])) + 1U)
+
+/* Record of the log and its sequence number (position in the log + 1), 0 while it is written */
+typedef struct
+{
+	uint32				Sequence;
+	Det_ErrorRecordType Record;
+} Det_LogEntryType;
 
 /* Variables to store last DET error */
 uint16 Det_ModuleId = 0;   /*DET module ID*/
@@ -17,11 +35,201 @@ uint8  Det_InstanceId = 0; /*DET instance ID*/
 uint8  Det_ApiId = 0;	   /* DET API ID*/
 uint8  Det_ErrorId = 0;	   /* DET Error ID*/
 
+STATIC volatile Det_LogEntryType Det_Log[DET_LOG_SIZE];
+
+/* Positions of the next record to write and of the oldest record not cleared, they only increase */
+STATIC volatile uint32 Det_LogHead = 0U;
+STATIC volatile uint32 Det_LogTail = 0U;
+
+STATIC const uint16 Det_CountedModules[] = {DET_COUNTED_MODULES(DET_COUNTED_MODULE)};
+
+STATIC volatile uint32 Det_ErrorCounts[DET_NUMBER_OF_COUNTERS];
+
+/************************************************************************************
+* Function Name		: Det_GetCounterIndex
+* Description		: Returns the counter of the module, the last one if it is not counted alone.
+************************************************************************************/
+STATIC uint8 Det_GetCounterIndex(uint16 ModuleId)
+{
+	uint8 Index = 0U;
+
+	while ((Index < (DET_NUMBER_OF_COUNTERS - 1U)) && (Det_CountedModules[Index] != ModuleId))
+	{
+		Index++;
+	}
+
+	return Index;
+}
+
+/************************************************************************************
+* Function Name		: Det_FindRecord
+* Description		: Returns the newest of the last DET_DEDUP_DEPTH published records equal to
+*					  the error, NULL_PTR if there is none.
+************************************************************************************/
+STATIC volatile Det_LogEntryType* Det_FindRecord(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+	volatile Det_LogEntryType* Found = NULL_PTR;
+	uint32					   Head = Det_LogHead;
+	uint32					   Used = Head - Det_LogTail;
+
+	for (uint32 Depth = 1U; (Depth <= DET_DEDUP_DEPTH) && (Depth <= Used) && (NULL_PTR == Found); Depth++)
+	{
+		uint32					   Position = Head - Depth;
+		volatile Det_LogEntryType* Entry = &Det_Log[Position & DET_LOG_MASK];
+
+		if ((Entry->Sequence == (Position + 1U)) && (Entry->Record.ModuleId == ModuleId) &&
+			(Entry->Record.InstanceId == InstanceId) && (Entry->Record.ApiId == ApiId) &&
+			(Entry->Record.ErrorId == ErrorId))
+		{
+			Found = Entry;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+
+	return Found;
+}
+
+/************************************************************************************
+* Function Name		: Det_ReserveRecord
+* Description		: Returns the position of a new record, an interrupt taken between the load
+*					  and the store of the head makes the store fail and the increment restart.
+************************************************************************************/
+STATIC uint32 Det_ReserveRecord(void)
+{
+	uint32 Position;
+
+	do
+	{
+		Position = LOAD_EXCLUSIVE(&Det_LogHead);
+	} while (0U != STORE_EXCLUSIVE(Position + 1U, &Det_LogHead));
+
+	return Position;
+}
+
+/*********************************************************************************************/
+void Det_Init(void)
+{
+	/* The records of the errors reported by Port_Init and the next drivers are stamped with it */
+	DWT_CYCLE_COUNTER_ENABLE();
+
+	for (uint8 Index = 0U; Index < DET_NUMBER_OF_COUNTERS; Index++)
+	{
+		Det_ErrorCounts[Index] = 0U;
+	}
+
+	Det_LogTail = Det_LogHead;
+}
+
+/*********************************************************************************************/
 Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
 {
+	uint32					   Timestamp = DET_GET_TIMESTAMP();
+	volatile Det_LogEntryType* Entry = Det_FindRecord(ModuleId, InstanceId, ApiId, ErrorId);
+	uint8					   Counter = Det_GetCounterIndex(ModuleId);
+
 	Det_ModuleId = ModuleId;
 	Det_InstanceId = InstanceId;
 	Det_ApiId = ApiId;
 	Det_ErrorId = ErrorId;
+
+	ATOMIC_INCREMENT(Det_ErrorCounts[Counter]);
+
+	if (NULL_PTR != Entry)
+	{
+		/* Same error as a recent record: one more occurrence */
+		ATOMIC_INCREMENT(Entry->Record.Count);
+		Entry->Record.Last_Timestamp = Timestamp;
+	}
+	else
+	{
+		uint32 Position = Det_ReserveRecord();
+
+		Entry = &Det_Log[Position & DET_LOG_MASK];
+
+		/* Hidden from the readers and from the search while it is written */
+		Entry->Sequence = 0U;
+		Entry->Record.First_Timestamp = Timestamp;
+		Entry->Record.Last_Timestamp = Timestamp;
+		Entry->Record.Count = 1U;
+		Entry->Record.ModuleId = ModuleId;
+		Entry->Record.InstanceId = InstanceId;
+		Entry->Record.ApiId = ApiId;
+		Entry->Record.ErrorId = ErrorId;
+		Entry->Sequence = Position + 1U;
+	}
+
 	return E_OK;
 }
+
+/*********************************************************************************************/
+uint8 Det_GetNumberOfRecords(void)
+{
+	uint32 Used = Det_LogHead - Det_LogTail;
+
+	return (uint8)((Used > DET_LOG_SIZE) ? DET_LOG_SIZE : Used);
+}
+
+/*********************************************************************************************/
+Std_ReturnType Det_GetRecord(uint8 Index, Det_ErrorRecordType* Record)
+{
+	Std_ReturnType Status = E_NOT_OK;
+	uint32		   Head = Det_LogHead;
+	uint32		   Used = Head - Det_LogTail;
+
+	if (Used > DET_LOG_SIZE)
+	{
+		Used = DET_LOG_SIZE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if ((NULL_PTR != Record) && (Index < Used))
+	{
+		uint32					   Position = (Head - Used) + Index;
+		volatile Det_LogEntryType* Entry = &Det_Log[Position & DET_LOG_MASK];
+
+		if (Entry->Sequence == (Position + 1U))
+		{
+			*Record = Entry->Record;
+
+			/* The copy is valid if the record was not overwritten meanwhile */
+			Status = (Entry->Sequence == (Position + 1U)) ? E_OK : E_NOT_OK;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+/*********************************************************************************************/
+uint32 Det_GetLostCount(void)
+{
+	uint32 Used = Det_LogHead - Det_LogTail;
+
+	return (Used > DET_LOG_SIZE) ? (Used - DET_LOG_SIZE) : 0U;
+}
+
+/*********************************************************************************************/
+uint32 Det_GetErrorCount(uint16 ModuleId)
+{
+	return Det_ErrorCounts[Det_GetCounterIndex(ModuleId)];
+}
+
+/*********************************************************************************************/
+void Det_Clear(void)
+{
+	/* The records before the tail are neither read nor counted again */
+	Det_LogTail = Det_LogHead;
+}
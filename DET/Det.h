@@ -2,8 +2,8 @@
  * @Module   	: DET
  * @Title 	 	: Development Error Tracer Module Header File
  * @Filename 	: Det.h
- * @Description : Det stores the development errors reported by other modules.
- *                This header file is a STUB for the Det Module
+ * @Description : Det stores the development errors reported by other modules in a log
+ *                of DET_LOG_SIZE records, the repeated errors are counted in their record
  * @Author 	 	: Hossam Mohamed
  * @Compiler 	: IAR 
  * @Notes    	: 
@@ -46,9 +46,37 @@
 	#error "The AR version of Std_Types.h does not match the expected version"
 #endif
 
+/* Det Pre-Compile Configuration Header file */
+#include "Det_Cfg.h"
+
+#if ((DET_LOG_SIZE == 0U) || (DET_LOG_SIZE > 128U) || ((DET_LOG_SIZE & (DET_LOG_SIZE - 1U)) != 0U))
+	#error "DET_LOG_SIZE must be a power of two up to 128"
+#endif
+
+#if (DET_DEDUP_DEPTH > DET_LOG_SIZE)
+	#error "DET_DEDUP_DEPTH must not be greater than DET_LOG_SIZE"
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* One error of the log and the number of times it was reported */
+typedef struct
+{
+	uint32 First_Timestamp; /* DET_GET_TIMESTAMP() of the first report */
+	uint32 Last_Timestamp;	/* DET_GET_TIMESTAMP() of the last report */
+	uint32 Count;			/* number of reports */
+	uint16 ModuleId;
+	uint8  InstanceId;
+	uint8  ApiId;
+	uint8  ErrorId;
+} Det_ErrorRecordType;
+
 /*******************************************************************************
  *                      External Variables                                     *
  *******************************************************************************/
+/* Last reported error */
 extern uint16 Det_ModuleId;	  /*DET module ID*/
 extern uint8  Det_InstanceId; /*DET instance ID*/
 extern uint8  Det_ApiId;	  /* DET API ID*/
@@ -57,6 +85,28 @@ extern uint8  Det_ErrorId;	  /* DET Error ID*/
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
+/* Start the time stamp counter and empty the log and the counters, before any module is initialized */
+void Det_Init(void);
+
+/* Log an error: an error equal to one of the DET_DEDUP_DEPTH newest records only increments its
+ * count, otherwise the next record is written. Lock-free, it can be called from any interrupt. */
 Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId);
 
+/* Number of records in the log (at most DET_LOG_SIZE) */
+uint8 Det_GetNumberOfRecords(void);
+
+/* Copy the record Index of the log, 0 is the oldest one. E_NOT_OK when Index is not in the log or
+ * when the record was being written or overwritten during the copy. */
+Std_ReturnType Det_GetRecord(uint8 Index, Det_ErrorRecordType* Record);
+
+/* Number of records overwritten by newer ones since the last Det_Clear */
+uint32 Det_GetLostCount(void);
+
+/* Number of errors reported by the module since Det_Init, neither lost with the overwritten records nor
+ * reset by Det_Clear. A module missing from DET_COUNTED_MODULES gets the count of all such modules. */
+uint32 Det_GetErrorCount(uint16 ModuleId);
+
+/* Empty the log */
+void Det_Clear(void);
+
 #endif /* DET_H */
@@ -0,0 +1,38 @@
+/******************************************************************
+ * @Module   	: DET
+ * @Title 	 	: Development Error Tracer Configuration Header File
+ * @Filename 	: Det_Cfg.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: 
+ ********************************************************************/
+
+#ifndef DET_CFG_H
+#define DET_CFG_H
+
+/* Number of error records kept in the log, a power of two (the oldest record is overwritten) */
+#define DET_LOG_SIZE	(16U)
+
+/* Number of the newest records searched for the same error before a new record is written, it
+ * bounds the cost of Det_ReportError */
+#define DET_DEDUP_DEPTH	(4U)
+
+/* Modules whose reports are counted one by one by Det_GetErrorCount, the reports of any other
+ * module share one more counter */
+#define DET_COUNTED_MODULES(MODULE) \
+	MODULE(54U)	 /* Dem */      \
+	MODULE(90U)	 /* Eep */      \
+	MODULE(100U) /* Gpt */      \
+	MODULE(120U) /* Dio */      \
+	MODULE(121U) /* Pwm */      \
+	MODULE(122U) /* Icu */      \
+	MODULE(124U) /* Port */     \
+	MODULE(255U) /* Uart */
+
+/* Time stamp of the records in core clock cycles, the counter is started by Det_Init */
+#ifndef DET_GET_TIMESTAMP
+	#define DET_GET_TIMESTAMP() DWT_GET_CYCLES()
+#endif
+
+#endif /* DET_CFG_H */
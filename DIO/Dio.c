@@ -27,6 +27,50 @@
 STATIC const Dio_ConfigChannel* Dio_PortChannels = NULL_PTR;
 STATIC uint8					Dio_Status = DIO_NOT_INITIALIZED;
 
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+/* RAM image of the levels written on every port, flips and refreshes are served from it */
+STATIC Dio_PortLevelType Dio_OutputShadow[DIO_CONFIGURED_PORTS];
+
+/* Mask of the configured output channels owned by the shadow on every port */
+STATIC uint8 Dio_OutputMask[DIO_CONFIGURED_PORTS];
+#endif
+
+/************************************************************************************
+* Function Name		: Dio_ReportUninit
+* Description		: Reports a call of an unchecked core (DIO_xxx macros) made before Dio_Init,
+*					  the core then does nothing. A constant ID makes the ID checks redundant but
+*					  says nothing of the state of the driver.
+************************************************************************************/
+STATIC void Dio_ReportUninit(uint8 ApiId)
+{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, ApiId, DIO_E_UNINIT);
+#else
+	(void)ApiId;
+#endif
+}
+
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+/************************************************************************************
+* Function Name		: Dio_WriteShadowed
+* Description		: Writes Value to the Mask channels of the shadow of a port and stores them
+*					  on the pins from the updated shadow, in the same exclusive sequence. An
+*					  interrupt writing the port in between makes the store-exclusive fail and the
+*					  pins are stored again from the shadow it left, so both always agree.
+************************************************************************************/
+STATIC FUNC_RAM void Dio_WriteShadowed(Dio_PortType PortId, uint32 Mask, uint32 Value)
+{
+	volatile uint32* Port_DATA_ptr = GPIO_DATA_MASKED(PortId, Mask);
+	uint32			 Shadow;
+
+	do
+	{
+		Shadow = (LOAD_EXCLUSIVE(&Dio_OutputShadow[PortId]) & ~Mask) | Value;
+		*Port_DATA_ptr = Shadow;
+	} while (0U != STORE_EXCLUSIVE(Shadow, &Dio_OutputShadow[PortId]));
+}
+#endif
+
 /************************************************************************************
 *  Service name      : Dio_Init
 *  Syntax            : void Dio_Init(const Dio_ConfigType* ConfigPtr)
@@ -62,6 +106,40 @@ void Dio_Init(const Dio_ConfigType* ConfigPtr)
 
 		/* address of the first Channels structure --> Channels[0] */
 		Dio_PortChannels = ConfigPtr->Channels;
+
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+		for (Dio_PortType PortId = STD_LOW; PortId < DIO_CONFIGURED_PORTS; PortId++)
+		{
+			Dio_OutputMask[PortId] = STD_LOW;
+		}
+
+		/* The shadow owns the configured channels that the Port driver has set as outputs */
+		for (Dio_ChannelType ChannelId = STD_LOW; ChannelId < DIO_CONFIGURED_CHANNLES; ChannelId++)
+		{
+			if (IS_BIT_SET(GPIO_PORT(Dio_PortChannels[ChannelId].Port_Num)->DIR,
+						   Dio_PortChannels[ChannelId].Ch_Num))
+			{
+				SET_BIT(Dio_OutputMask[Dio_PortChannels[ChannelId].Port_Num], Dio_PortChannels[ChannelId].Ch_Num);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		/* Seed the shadow with the levels already driven, so the first refresh changes nothing */
+		for (Dio_PortType PortId = STD_LOW; PortId < DIO_CONFIGURED_PORTS; PortId++)
+		{
+			if (STD_LOW != Dio_OutputMask[PortId])
+			{
+				Dio_OutputShadow[PortId] = (Dio_PortLevelType)(GPIO_PORT(PortId)->DATA[GPIO_ALL_PINS]);
+			}
+			else
+			{
+				/* No Action Required ... the port may not even be clocked */
+			}
+		}
+#endif
 	}
 }
 
@@ -81,8 +159,7 @@ void Dio_Init(const Dio_ConfigType* ConfigPtr)
  ************************************************************************************/
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-	volatile uint32* Port_DATA_ptr = NULL_PTR;
-	boolean			 error = FALSE;
+	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* Check if the Driver is initialized before using this function */
@@ -111,19 +188,33 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	/* In-case there are no errors */
 	if (FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		Port_DATA_ptr = GPIODATA[Dio_PortChannels[ChannelId].Port_Num];
+		Dio_WriteChannelUnchecked(ChannelId, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/*********************************************************************************************/
+FUNC_RAM void Dio_WriteChannelUnchecked(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+	if (DIO_INITIALIZED == Dio_Status)
+	{
+		uint32 Channel = BIT(Dio_PortChannels[ChannelId].Ch_Num);
 
 		/* Write the required level in the corresponding ChannelId in the Port */
-		if (Level == STD_HIGH) /* Write Logic High */
+		if ((Level == STD_HIGH) || (Level == STD_LOW))
 		{
-			/* Misra justfication: Assuming Port_DATA_ptr and Dio_PortChannels[ChannelId].Ch_Num are of appropriate types */
-			SET_BIT(*Port_DATA_ptr, Dio_PortChannels[ChannelId].Ch_Num);
-		}
-		else if (Level == STD_LOW) /* Write Logic Low */
-		{
-			/* Misra justfication: Assuming Port_DATA_ptr and Dio_PortChannels[ChannelId].Ch_Num are of appropriate types */
-			CLEAR_BIT(*Port_DATA_ptr, Dio_PortChannels[ChannelId].Ch_Num);
+			uint32 Value = (Level == STD_HIGH) ? Channel : STD_LOW;
+
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+			Dio_WriteShadowed(Dio_PortChannels[ChannelId].Port_Num, Channel, Value);
+#else
+			/* Point to the DATA alias of the Port that only exposes the required channel, so the level
+			 * is written with a single store instead of a read-modify-write of the whole port */
+			*GPIO_DATA_MASKED(Dio_PortChannels[ChannelId].Port_Num, Channel) = Value;
+#endif
 		}
 		else
 		{
@@ -132,7 +223,7 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	}
 	else
 	{
-		/* No Action Required */
+		Dio_ReportUninit(DIO_WRITE_CHANNEL_SID);
 	}
 }
 
@@ -154,8 +245,7 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
  ************************************************************************************/
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32* Port_DATA_ptr = NULL_PTR;
-	boolean			 error = FALSE;
+	boolean error = FALSE;
 
 	Dio_LevelType ChannelLevel = STD_LOW; /* Default value */
 
@@ -184,12 +274,28 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 
 	/* In-case there are no errors */
 	if (FALSE == error)
+	{
+		ChannelLevel = Dio_ReadChannelUnchecked(ChannelId);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return ChannelLevel;
+}
+
+/*********************************************************************************************/
+FUNC_RAM Dio_LevelType Dio_ReadChannelUnchecked(Dio_ChannelType ChannelId)
+{
+	Dio_LevelType ChannelLevel = STD_LOW;
+
+	if (DIO_INITIALIZED == Dio_Status)
 	{
 		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		Port_DATA_ptr = GPIODATA[Dio_PortChannels[ChannelId].Port_Num];
+		volatile uint32* Port_DATA_ptr = &GPIO_PORT(Dio_PortChannels[ChannelId].Port_Num)->DATA[GPIO_ALL_PINS];
 
 		if (READ_BIT(*Port_DATA_ptr, Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
-		//if (IS_BIT_SET(*Port_DATA_ptr, Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
 		{
 			ChannelLevel = STD_HIGH;
 		}
@@ -200,7 +306,7 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	}
 	else
 	{
-		/* No Action Required */
+		Dio_ReportUninit(DIO_READ_CHANNEL_SID);
 	}
 
 	return ChannelLevel;
@@ -221,8 +327,7 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
  ************************************************************************************/
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
 {
-	volatile uint32* Port_DATA_ptr = NULL_PTR;
-	boolean			 error = FALSE;
+	boolean error = FALSE;
 
 	Dio_PortLevelType PortLevel = STD_LOW; /* Default value */
 
@@ -251,8 +356,7 @@ Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
 	/* In-case there are no errors */
 	if (FALSE == error)
 	{
-		Port_DATA_ptr = GPIODATA[PortId];
-		PortLevel = (Dio_PortLevelType)(*Port_DATA_ptr); //TODO: check if this is correct
+		PortLevel = Dio_ReadPortUnchecked(PortId);
 	}
 	else
 	{
@@ -261,6 +365,24 @@ Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
 	return PortLevel;
 }
 
+/*********************************************************************************************/
+FUNC_RAM Dio_PortLevelType Dio_ReadPortUnchecked(Dio_PortType PortId)
+{
+	Dio_PortLevelType PortLevel = STD_LOW;
+
+	if (DIO_INITIALIZED == Dio_Status)
+	{
+		/* The DATA alias of all the pins returns the level of the whole port */
+		PortLevel = (Dio_PortLevelType)GPIO_PORT(PortId)->DATA[GPIO_ALL_PINS];
+	}
+	else
+	{
+		Dio_ReportUninit(DIO_READ_PORT_SID);
+	}
+
+	return PortLevel;
+}
+
 /************************************************************************************
  * Service name      : Dio_ReadPort
 *  Syntax            : Dio_PortLevelType Dio_ReadPort( Dio_PortType PortId )
@@ -276,8 +398,7 @@ Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
  ************************************************************************************/
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
 {
-	volatile uint32* Port_DATA_ptr = NULL_PTR;
-	boolean			 error = FALSE;
+	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* Check if the Driver is initialized before using this function */
@@ -304,8 +425,7 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
 
 	if (FALSE == error)
 	{
-		Port_DATA_ptr = GPIODATA[PortId];
-		*Port_DATA_ptr = Level; // TODO: check if this is correct
+		Dio_WritePortUnchecked(PortId, Level);
 	}
 	else
 	{
@@ -313,6 +433,24 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
 	}
 }
 
+/*********************************************************************************************/
+FUNC_RAM void Dio_WritePortUnchecked(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	if (DIO_INITIALIZED == Dio_Status)
+	{
+		/* The DATA alias of all the pins writes every pin of the port, input pins ignore it */
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+		Dio_WriteShadowed(PortId, GPIO_ALL_PINS, Level & GPIO_ALL_PINS);
+#else
+		GPIO_PORT(PortId)->DATA[GPIO_ALL_PINS] = Level;
+#endif
+	}
+	else
+	{
+		Dio_ReportUninit(DIO_WRITE_PORT_SID);
+	}
+}
+
 /************************************************************************************
 *  Service name      : Dio_ReadChannelGroup
 *  Syntax            : Dio_PortLevelType Dio_ReadChannelGroup(
@@ -331,8 +469,7 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
  ************************************************************************************/
 Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr)
 {
-	volatile uint32* Port_DATA_ptr = NULL_PTR;
-	boolean			 error = FALSE;
+	boolean error = FALSE;
 
 	Dio_PortLevelType GroupLevel = STD_LOW; /* Default value */
 
@@ -360,17 +497,34 @@ Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupI
 #endif
 
 	if (FALSE == error)
+	{
+		GroupLevel = Dio_ReadChannelGroupUnchecked(ChannelGroupIdPtr);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return GroupLevel;
+}
+
+/*********************************************************************************************/
+FUNC_RAM Dio_PortLevelType Dio_ReadChannelGroupUnchecked(const Dio_ChannelGroupType* ChannelGroupIdPtr)
+{
+	Dio_PortLevelType GroupLevel = STD_LOW;
+
+	if (DIO_INITIALIZED == Dio_Status)
 	{
 		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		Port_DATA_ptr = GPIODATA[ChannelGroupIdPtr->PortIndex];
+		volatile uint32* Port_DATA_ptr = &GPIO_PORT(ChannelGroupIdPtr->PortIndex)->DATA[GPIO_ALL_PINS];
 
-		/* Read the required bits from the input port and mask it with the required value */ //TODO: check if this is correct
+		/* Shift the group down to bit 0 and keep only its channels */
 		GroupLevel = ((*Port_DATA_ptr) >> ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask;
 	}
 	else
 	{
-		/* No Action Required */
+		Dio_ReportUninit(DIO_READ_CHANNEL_GROUP_SID);
 	}
+
 	return GroupLevel;
 }
 
@@ -392,10 +546,6 @@ Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupI
  ************************************************************************************/
 void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_PortLevelType Level)
 {
-	volatile uint32* Port_DATA_ptr = NULL_PTR;
-	uint8			 mask = STD_LOW;
-	uint8			 offset = STD_LOW;
-
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -423,19 +573,35 @@ void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_Po
 	/* In-case there are no errors */
 	if (FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		Port_DATA_ptr = GPIODATA[ChannelGroupIdPtr->PortIndex];
+		Dio_WriteChannelGroupUnchecked(ChannelGroupIdPtr, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
 
+/*********************************************************************************************/
+FUNC_RAM void Dio_WriteChannelGroupUnchecked(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+	if (DIO_INITIALIZED == Dio_Status)
+	{
 		/* Get the mask and offset of the ChannelGroupIdPtr */
-		mask = ChannelGroupIdPtr->mask;
-		offset = ChannelGroupIdPtr->offset;
-
-		/* Read the required bits from the input port and mask it with the required value */ //TODO: check if this is correct
-		*Port_DATA_ptr = ((*Port_DATA_ptr) & (~(mask << offset))) | ((Level & mask) << offset);
+		uint8 mask = ChannelGroupIdPtr->mask;
+		uint8 offset = ChannelGroupIdPtr->offset;
+
+		/* Write the group bits only, the other channels of the port are masked by the address of the
+		 * DATA alias and are never touched in the shadow */
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+		Dio_WriteShadowed(ChannelGroupIdPtr->PortIndex, (uint32)mask << offset,
+						  (uint32)(Level & mask) << offset);
+#else
+		*GPIO_DATA_MASKED(ChannelGroupIdPtr->PortIndex, (uint32)mask << offset) = (Level & mask) << offset;
+#endif
 	}
 	else
 	{
-		/* No Action Required */
+		Dio_ReportUninit(DIO_WRITE_CHANNEL_GROUP_SID);
 	}
 }
 
@@ -503,8 +669,7 @@ void Dio_GetVersionInfo(Std_VersionInfoType* versioninfo)
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32* Port_DATA_ptr = NULL_PTR;
-	boolean			 error = FALSE;
+	boolean error = FALSE;
 
 	Dio_LevelType ChannelLevel = STD_LOW; /* Default value */
 
@@ -533,9 +698,52 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 
 	/* In-case there are no errors */
 	if (FALSE == error)
+	{
+		ChannelLevel = Dio_FlipChannelUnchecked(ChannelId);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return ChannelLevel;
+}
+
+/*********************************************************************************************/
+FUNC_RAM Dio_LevelType Dio_FlipChannelUnchecked(Dio_ChannelType ChannelId)
+{
+	volatile uint32* Port_DATA_ptr = NULL_PTR;
+	Dio_LevelType	 ChannelLevel = STD_LOW;
+
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Dio_ReportUninit(DIO_FLIP_CHANNEL_SID);
+	}
+	#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+	else if (IS_BIT_SET(Dio_OutputMask[Dio_PortChannels[ChannelId].Port_Num],
+						Dio_PortChannels[ChannelId].Ch_Num))
+	{
+		/* Output channel owned by the shadow: flip it in RAM and store it from the flipped shadow in
+		 * the same exclusive sequence (see Dio_WriteShadowed), the port is never read */
+		uint32 Shadow;
+
+		Port_DATA_ptr =
+			GPIO_DATA_MASKED(Dio_PortChannels[ChannelId].Port_Num, BIT(Dio_PortChannels[ChannelId].Ch_Num));
+
+		do
+		{
+			Shadow = LOAD_EXCLUSIVE(&Dio_OutputShadow[Dio_PortChannels[ChannelId].Port_Num]) ^
+					 BIT(Dio_PortChannels[ChannelId].Ch_Num);
+			*Port_DATA_ptr = Shadow;
+		} while (0U != STORE_EXCLUSIVE(Shadow, &Dio_OutputShadow[Dio_PortChannels[ChannelId].Port_Num]));
+
+		ChannelLevel = (Dio_LevelType)READ_BIT(Shadow, Dio_PortChannels[ChannelId].Ch_Num);
+	}
+	#endif
+	else
 	{
 		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		Port_DATA_ptr = GPIODATA[Dio_PortChannels[ChannelId].Port_Num];
+		Port_DATA_ptr = &GPIO_PORT(Dio_PortChannels[ChannelId].Port_Num)->DATA[GPIO_ALL_PINS];
 
 		/* Toggle the required channel */
 		TOGGLE_BIT(*Port_DATA_ptr, Dio_PortChannels[ChannelId].Ch_Num);
@@ -550,11 +758,50 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 			ChannelLevel = STD_LOW;
 		}
 	}
+
+	return ChannelLevel;
+}
+#endif
+
+/************************************************************************************
+*  Service name      : Dio_RefreshOutputs
+*  Syntax            : void Dio_RefreshOutputs(void)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x20
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non Reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Service to re-assert the levels of all the output channels owned by the
+*                      shadow, using a single store per port (Not exist in AUTOSAR 4.0.3 DIO SWS
+*                      Document).
+ ************************************************************************************/
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+void Dio_RefreshOutputs(void)
+{
+	#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_REFRESH_OUTPUTS_SID, DIO_E_UNINIT);
+	}
 	else
+	#endif
 	{
-		/* No Action Required */
+		for (Dio_PortType PortId = STD_LOW; PortId < DIO_CONFIGURED_PORTS; PortId++)
+		{
+			if (STD_LOW != Dio_OutputMask[PortId])
+			{
+				/* Only the owned channels are exposed by the address, inputs are left untouched */
+				*GPIO_DATA_MASKED(PortId, Dio_OutputMask[PortId]) = Dio_OutputShadow[PortId];
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
 	}
-
-	return ChannelLevel;
 }
 #endif
@@ -101,6 +101,9 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID		   (uint8)0x11
 
+/* Service ID for DIO refresh Outputs (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_REFRESH_OUTPUTS_SID		   (uint8)0x20
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -198,16 +201,76 @@ void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_Po
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
 #endif
 
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+/* Function for DIO refresh Outputs API */
+void Dio_RefreshOutputs(void);
+#endif
+
 #if (DIO_VERSION_INFO_API == STD_ON)
 /* Function for DIO Get Version Info API */
 void Dio_GetVersionInfo(Std_VersionInfoType* versioninfo);
 #endif
 
+/*
+ * Unchecked cores of the APIs above, without the DET checks of the arguments: they must be valid.
+ * A call before Dio_Init is still reported (DIO_E_UNINIT) and does nothing. They are meant to be
+ * reached through the DIO_xxx macros below.
+ * They are FUNC_RAM functions and read their channels from the CONST_FAST Dio_Configuration.
+ */
+void			  Dio_WriteChannelUnchecked(Dio_ChannelType ChannelId, Dio_LevelType Level);
+Dio_LevelType	  Dio_ReadChannelUnchecked(Dio_ChannelType ChannelId);
+Dio_PortLevelType Dio_ReadPortUnchecked(Dio_PortType PortId);
+void			  Dio_WritePortUnchecked(Dio_PortType PortId, Dio_PortLevelType Level);
+Dio_PortLevelType Dio_ReadChannelGroupUnchecked(const Dio_ChannelGroupType* ChannelGroupIdPtr);
+void			  Dio_WriteChannelGroupUnchecked(const Dio_ChannelGroupType* ChannelGroupIdPtr,
+												 Dio_PortLevelType			 Level);
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+Dio_LevelType Dio_FlipChannelUnchecked(Dio_ChannelType ChannelId);
+#endif
+
+/*******************************************************************************
+ *                      Compile-Time Checked APIs                              *
+ *******************************************************************************/
+/*
+ * The channel, port and group IDs are checked when compiling instead of by the DET at every call:
+ * an ID out of the configuration, or an ID that is not a compile-time constant, does not compile.
+ * The initialization of the driver is still checked at run time by the unchecked cores.
+ * Use the Dio_xxx functions when the ID is only known at run time.
+ */
+#define DIO_CHECK_CHANNEL(ChannelId) STATIC_ASSERT_EXPR((ChannelId) < DIO_CONFIGURED_CHANNLES)
+#define DIO_CHECK_PORT(PortId)		 STATIC_ASSERT_EXPR((PortId) < DIO_CONFIGURED_PORTS)
+
+/* A group is given by its port, mask and offset, all its channels must be in the 8 pins of the port */
+#define DIO_CHECK_GROUP(PortId, Mask, Offset) \
+	(DIO_CHECK_PORT(PortId), STATIC_ASSERT_EXPR(((Mask) != 0U) && ((((uint32)(Mask)) << (Offset)) <= 0xFFU)))
+
+#define DIO_GROUP(PortId, Mask, Offset)		  (&(const Dio_ChannelGroupType){(Mask), (Offset), (PortId)})
+
+#define DIO_WRITE_CHANNEL(ChannelId, Level) \
+	(DIO_CHECK_CHANNEL(ChannelId), Dio_WriteChannelUnchecked((ChannelId), (Level)))
+
+#define DIO_READ_CHANNEL(ChannelId)		  (DIO_CHECK_CHANNEL(ChannelId), Dio_ReadChannelUnchecked(ChannelId))
+
+#define DIO_READ_PORT(PortId)			  (DIO_CHECK_PORT(PortId), Dio_ReadPortUnchecked(PortId))
+
+#define DIO_WRITE_PORT(PortId, Level)	  (DIO_CHECK_PORT(PortId), Dio_WritePortUnchecked((PortId), (Level)))
+
+#define DIO_READ_CHANNEL_GROUP(PortId, Mask, Offset) \
+	(DIO_CHECK_GROUP(PortId, Mask, Offset), Dio_ReadChannelGroupUnchecked(DIO_GROUP(PortId, Mask, Offset)))
+
+#define DIO_WRITE_CHANNEL_GROUP(PortId, Mask, Offset, Level) \
+	(DIO_CHECK_GROUP(PortId, Mask, Offset),                  \
+	 Dio_WriteChannelGroupUnchecked(DIO_GROUP(PortId, Mask, Offset), (Level)))
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+	#define DIO_FLIP_CHANNEL(ChannelId) (DIO_CHECK_CHANNEL(ChannelId), Dio_FlipChannelUnchecked(ChannelId))
+#endif
+
 /*******************************************************************************
  *                       External Variables                                    *
  *******************************************************************************/
 
 /* Extern PB structures to be used by Dio and other modules */
-extern const Dio_ConfigType Dio_Configuration;
+extern CONST_FAST Dio_ConfigType Dio_Configuration;
 
 #endif /* DIO_H */
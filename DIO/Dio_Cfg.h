@@ -34,6 +34,9 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API			 (STD_ON)
 
+/* Pre-compile option for the RAM shadow of the output channels and the Dio_RefreshOutputs API */
+#define DIO_OUTPUT_SHADOW_API			 (STD_ON)
+
 /* Number of the configured Dio Channels */
 #define DIO_CONFIGURED_CHANNLES			 (4U)
 
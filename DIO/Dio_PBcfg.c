@@ -38,8 +38,8 @@
 	#error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
-/* PB structure used with Dio_Init API */
-const Dio_ConfigType Dio_Configuration = {
+/* PB structure used with Dio_Init API, read by the channel accessors so it is kept in the SRAM */
+CONST_FAST Dio_ConfigType Dio_Configuration = {
 
 	.Channels =
 		{
@@ -0,0 +1,389 @@
+/******************************************************************
+ * @Module   	: Eep
+ * @Title 	 	: EEPROM Driver Source file
+ * @Filename 	: Eep.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	: A word is programmed by writing EERDWR once EEBLOCK/EEOFFSET select it,
+ *                the EEPROM then stays busy (EEDONE.WORKING) for a few milliseconds.
+ ********************************************************************/
+
+#include "Eep.h"
+#include "Peripheral_Regs.h"
+
+#if (EEP_DEV_ERROR_DETECT == STD_ON)
+
+	#include "Det.h"
+
+	/* AUTOSAR Version checking between Det and Eep Modules */
+	#if ((DET_AR_MAJOR_VERSION != EEP_AR_RELEASE_MAJOR_VERSION) || \
+		 (DET_AR_MINOR_VERSION != EEP_AR_RELEASE_MINOR_VERSION) || \
+		 (DET_AR_PATCH_VERSION != EEP_AR_RELEASE_PATCH_VERSION))
+		#error "The AR version of Det.h does not match the expected version"
+	#endif
+
+#endif
+
+/* EEDONE: programming or erase in progress, write without permission, write while busy */
+#define EEP_DONE_WORKING (0x00000001U)
+#define EEP_DONE_NOPERM	 (0x00000010U)
+#define EEP_DONE_WRBUSY	 (0x00000020U)
+
+/* EESUPP: the start-up recovery of an interrupted erase or program failed */
+#define EEP_SUPP_ERETRY	 (0x00000004U)
+#define EEP_SUPP_PRETRY	 (0x00000008U)
+
+/* Number of bytes of a word */
+#define EEP_WORD_SIZE	 (4U)
+
+STATIC Eep_StatusType	 Eep_Status = EEP_UNINIT;
+STATIC Eep_JobResultType Eep_JobResult = EEP_JOB_OK;
+
+/* Running write job: next source word, its word index in the EEPROM and the words left */
+STATIC const uint32* Eep_JobData = NULL_PTR;
+STATIC uint32		 Eep_JobWord = 0U;
+STATIC uint32		 Eep_JobWordsLeft = 0U;
+
+/************************************************************************************
+* Function Name		: Eep_WaitDone
+* Description		: Waits for the end of the running EEPROM operation, only used by Eep_Init
+*					  (start-up recovery), the jobs never wait.
+************************************************************************************/
+STATIC void Eep_WaitDone(void)
+{
+	while (0U != (EEPROM_EEDONE & EEP_DONE_WORKING))
+	{
+		/* Do Nothing */
+	}
+}
+
+/************************************************************************************
+* Function Name		: Eep_SelectWord
+* Description		: Points EERDWR to the word Word of the EEPROM.
+************************************************************************************/
+STATIC void Eep_SelectWord(uint32 Word)
+{
+	EEPROM_EEBLOCK = Word / EEP_BLOCK_WORDS;
+	EEPROM_EEOFFSET = Word % EEP_BLOCK_WORDS;
+}
+
+#if (EEP_DEV_ERROR_DETECT == STD_ON)
+/************************************************************************************
+* Function Name		: Eep_CheckRequest
+* Description		: Reports the DET error of an invalid read or write request and returns
+*					  E_NOT_OK for it.
+************************************************************************************/
+STATIC Std_ReturnType Eep_CheckRequest(uint8 ApiId, Eep_AddressType EepromAddress, const uint32* DataBufferPtr,
+									   Eep_LengthType Length)
+{
+	uint8 ErrorId = 0U;
+
+	if (EEP_UNINIT == Eep_Status)
+	{
+		ErrorId = EEP_E_UNINIT;
+	}
+	else if (NULL_PTR == DataBufferPtr)
+	{
+		ErrorId = EEP_E_PARAM_DATA;
+	}
+	else if ((EepromAddress >= EEP_SIZE) || (0U != (EepromAddress % EEP_WORD_SIZE)))
+	{
+		ErrorId = EEP_E_PARAM_ADDRESS;
+	}
+	else if ((0U == Length) || (0U != (Length % EEP_WORD_SIZE)) || (Length > (EEP_SIZE - EepromAddress)))
+	{
+		ErrorId = EEP_E_PARAM_LENGTH;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if (0U != ErrorId)
+	{
+		Det_ReportError(EEP_MODULE_ID, EEP_INSTANCE_ID, ApiId, ErrorId);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return (0U != ErrorId) ? E_NOT_OK : E_OK;
+}
+#endif
+
+/************************************************************************************
+ * Service name      : Eep_Init
+*  Syntax            : void Eep_Init(void)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x00
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to Initialize the Eep driver: the EEPROM is clocked and reset,
+*                      and the driver stays EEP_UNINIT if the EEPROM cannot recover from an
+*                      interrupted operation (sequence of the TM4C123 data sheet).
+ ************************************************************************************/
+void Eep_Init(void)
+{
+	SET_BIT(RCGCEEPROM, 0U);
+
+	while (0U == (PREEPROM & 1U))
+	{
+		/* Do Nothing */
+	}
+
+	Eep_WaitDone();
+
+	if (0U == (EEPROM_EESUPP & (EEP_SUPP_ERETRY | EEP_SUPP_PRETRY)))
+	{
+		SET_BIT(SREEPROM, 0U);
+		CLEAR_BIT(SREEPROM, 0U);
+
+		while (0U == (PREEPROM & 1U))
+		{
+			/* Do Nothing */
+		}
+
+		Eep_WaitDone();
+
+		if (0U == (EEPROM_EESUPP & (EEP_SUPP_ERETRY | EEP_SUPP_PRETRY)))
+		{
+			Eep_JobResult = EEP_JOB_OK;
+			Eep_Status = EEP_IDLE;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Service name      : Eep_Read
+*  Syntax            : Std_ReturnType Eep_Read(Eep_AddressType EepromAddress, uint32* DataBufferPtr,
+*                                              Eep_LengthType Length)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x02
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : EepromAddress - Byte address of the first word (multiple of 4)
+*                      Length - Number of bytes (multiple of 4)
+*  Parameters (inout): None
+*  Parameters (out)  : DataBufferPtr - Words read
+*  Return value      : Std_ReturnType - E_NOT_OK when the request is invalid or a write job runs
+*  Description       : Function to read words of the EEPROM.
+ ************************************************************************************/
+Std_ReturnType Eep_Read(Eep_AddressType EepromAddress, uint32* DataBufferPtr, Eep_LengthType Length)
+{
+	Std_ReturnType Status = E_OK;
+
+#if (EEP_DEV_ERROR_DETECT == STD_ON)
+	Status = Eep_CheckRequest(EEP_READ_SID, EepromAddress, DataBufferPtr, Length);
+#endif
+
+	if ((E_OK == Status) && (EEP_IDLE == Eep_Status))
+	{
+		uint32 Word = EepromAddress / EEP_WORD_SIZE;
+
+		for (uint32 Index = 0U; Index < (Length / EEP_WORD_SIZE); Index++)
+		{
+			Eep_SelectWord(Word + Index);
+			DataBufferPtr[Index] = EEPROM_EERDWR;
+		}
+	}
+	else
+	{
+		Status = E_NOT_OK;
+	}
+
+	return Status;
+}
+
+/************************************************************************************
+ * Service name      : Eep_Write
+*  Syntax            : Std_ReturnType Eep_Write(Eep_AddressType EepromAddress, const uint32* DataBufferPtr,
+*                                               Eep_LengthType Length)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x03
+*  Sync/Async        : Asynchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : EepromAddress - Byte address of the first word (multiple of 4)
+*                      DataBufferPtr - Words to write, unchanged until the end of the job
+*                      Length - Number of bytes (multiple of 4)
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : Std_ReturnType - E_NOT_OK when the request is invalid or a job runs
+*  Description       : Function to start a write job, done by Eep_MainFunction.
+ ************************************************************************************/
+Std_ReturnType Eep_Write(Eep_AddressType EepromAddress, const uint32* DataBufferPtr, Eep_LengthType Length)
+{
+	Std_ReturnType Status = E_OK;
+
+#if (EEP_DEV_ERROR_DETECT == STD_ON)
+	Status = Eep_CheckRequest(EEP_WRITE_SID, EepromAddress, DataBufferPtr, Length);
+
+	if ((E_OK == Status) && (EEP_BUSY == Eep_Status))
+	{
+		Det_ReportError(EEP_MODULE_ID, EEP_INSTANCE_ID, EEP_WRITE_SID, EEP_E_BUSY);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if ((E_OK == Status) && (EEP_IDLE == Eep_Status))
+	{
+		Eep_JobData = DataBufferPtr;
+		Eep_JobWord = EepromAddress / EEP_WORD_SIZE;
+		Eep_JobWordsLeft = Length / EEP_WORD_SIZE;
+		Eep_JobResult = EEP_JOB_PENDING;
+		Eep_Status = EEP_BUSY;
+	}
+	else
+	{
+		Status = E_NOT_OK;
+	}
+
+	return Status;
+}
+
+/*********************************************************************************************/
+Eep_StatusType Eep_GetStatus(void)
+{
+	return Eep_Status;
+}
+
+/*********************************************************************************************/
+Eep_JobResultType Eep_GetJobResult(void)
+{
+#if (EEP_DEV_ERROR_DETECT == STD_ON)
+	if (EEP_UNINIT == Eep_Status)
+	{
+		Det_ReportError(EEP_MODULE_ID, EEP_INSTANCE_ID, EEP_GET_JOB_RESULT_SID, EEP_E_UNINIT);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	return Eep_JobResult;
+}
+
+/************************************************************************************
+ * Service name      : Eep_MainFunction
+*  Syntax            : void Eep_MainFunction(void)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x07
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to run the write job: it returns at once while a word is being
+*                      programmed, otherwise it skips the words already holding their value and
+*                      starts the programming of the next different one. Rewriting an unchanged
+*                      word would only wear the EEPROM.
+ ************************************************************************************/
+void Eep_MainFunction(void)
+{
+	if ((EEP_BUSY == Eep_Status) && (0U == (EEPROM_EEDONE & EEP_DONE_WORKING)))
+	{
+		boolean Started = FALSE;
+
+		if (0U != (EEPROM_EEDONE & (EEP_DONE_NOPERM | EEP_DONE_WRBUSY)))
+		{
+			/* The last programming was rejected */
+			Eep_JobWordsLeft = 0U;
+			Eep_JobResult = EEP_JOB_FAILED;
+			Eep_Status = EEP_IDLE;
+		}
+		else
+		{
+			while ((FALSE == Started) && (0U != Eep_JobWordsLeft))
+			{
+				Eep_SelectWord(Eep_JobWord);
+
+				if (EEPROM_EERDWR != *Eep_JobData)
+				{
+					EEPROM_EERDWR = *Eep_JobData;
+					Started = TRUE;
+				}
+				else
+				{
+					/* No Action Required */
+				}
+
+				Eep_JobData++;
+				Eep_JobWord++;
+				Eep_JobWordsLeft--;
+			}
+
+			if (FALSE == Started)
+			{
+				Eep_JobResult = EEP_JOB_OK;
+				Eep_Status = EEP_IDLE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+*  Service name      : Eep_GetVersionInfo
+*  Syntax            : void Eep_GetVersionInfo(Std_VersionInfoType* versioninfo )
+*  Mode              : User Mode (Non-Privileged Mode)
+*  Service ID[hex]   : 0x0A
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : versioninfo - Pointer to where to store the version
+*                      information of this module.
+*  Return value      : None
+*  Description       : Service to get the version information of this module
+ ************************************************************************************/
+#if (EEP_VERSION_INFO_API == STD_ON)
+void Eep_GetVersionInfo(Std_VersionInfoType* versioninfo)
+{
+	#if (EEP_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(EEP_MODULE_ID, EEP_INSTANCE_ID, EEP_GET_VERSION_INFO_SID, EEP_E_PARAM_DATA);
+	}
+	else
+	#endif /* (EEP_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)EEP_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)EEP_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)EEP_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)EEP_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)EEP_SW_PATCH_VERSION;
+	}
+}
+#endif
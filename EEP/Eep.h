@@ -0,0 +1,164 @@
+/******************************************************************
+ * @Module   	: Eep
+ * @Title 	 	: EEPROM Driver Header File
+ * @Filename 	: Eep.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: Internal EEPROM of the TM4C123, accessed by 32-bit words. Reads are
+ *                synchronous, writes are jobs run by Eep_MainFunction one word at a time
+ *                so that no caller ever waits for the EEPROM programming.
+ ********************************************************************/
+
+#ifndef EEP_H
+#define EEP_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define EEP_VENDOR_ID				 (1000U)
+
+/* Eep Module Id */
+#define EEP_MODULE_ID				 (90U)
+
+/* Eep Instance Id */
+#define EEP_INSTANCE_ID				 (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define EEP_SW_MAJOR_VERSION		 (1U)
+#define EEP_SW_MINOR_VERSION		 (0U)
+#define EEP_SW_PATCH_VERSION		 (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define EEP_AR_RELEASE_MAJOR_VERSION (4U)
+#define EEP_AR_RELEASE_MINOR_VERSION (0U)
+#define EEP_AR_RELEASE_PATCH_VERSION (3U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Eep Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != EEP_AR_RELEASE_MAJOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_MINOR_VERSION != EEP_AR_RELEASE_MINOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_PATCH_VERSION != EEP_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Eep Pre-Compile Configuration Header file */
+#include "Eep_Cfg.h"
+
+/* AUTOSAR Version checking between Eep_Cfg.h and Eep.h files */
+#if ((EEP_CFG_AR_RELEASE_MAJOR_VERSION != EEP_AR_RELEASE_MAJOR_VERSION) || \
+	 (EEP_CFG_AR_RELEASE_MINOR_VERSION != EEP_AR_RELEASE_MINOR_VERSION) || \
+	 (EEP_CFG_AR_RELEASE_PATCH_VERSION != EEP_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Eep_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Eep_Cfg.h and Eep.h files */
+#if ((EEP_CFG_SW_MAJOR_VERSION != EEP_SW_MAJOR_VERSION) || \
+	 (EEP_CFG_SW_MINOR_VERSION != EEP_SW_MINOR_VERSION) || \
+	 (EEP_CFG_SW_PATCH_VERSION != EEP_SW_PATCH_VERSION))
+	#error "The SW version of Eep_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for EEP Init */
+#define EEP_INIT_SID				 (uint8)0x00
+
+/* Service ID for EEP Read */
+#define EEP_READ_SID				 (uint8)0x02
+
+/* Service ID for EEP Write */
+#define EEP_WRITE_SID				 (uint8)0x03
+
+/* Service ID for EEP GetJobResult */
+#define EEP_GET_JOB_RESULT_SID		 (uint8)0x06
+
+/* Service ID for EEP MainFunction */
+#define EEP_MAIN_FUNCTION_SID		 (uint8)0x07
+
+/* Service ID for EEP GetVersionInfo */
+#define EEP_GET_VERSION_INFO_SID	 (uint8)0x0A
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* DET code to report an address out of the EEPROM or not aligned on a word */
+#define EEP_E_PARAM_ADDRESS			 (uint8)0x11
+
+/* DET code to report that an API service is called with a NULL pointer parameter */
+#define EEP_E_PARAM_DATA			 (uint8)0x12
+
+/* DET code to report a length of 0, not a number of words or past the end of the EEPROM */
+#define EEP_E_PARAM_LENGTH			 (uint8)0x13
+
+/* DET code to report that an API service is called without module initialization */
+#define EEP_E_UNINIT				 (uint8)0x20
+
+/* DET code to report that a job is requested while the previous one is still running */
+#define EEP_E_BUSY					 (uint8)0x21
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Eep_AddressType, byte address in the EEPROM (multiple of 4) */
+typedef uint32 Eep_AddressType;
+
+/* Type definition for Eep_LengthType, number of bytes (multiple of 4) */
+typedef uint32 Eep_LengthType;
+
+/* State of the driver */
+typedef enum
+{
+	EEP_UNINIT, /* not initialized, or the EEPROM failed its start-up recovery */
+	EEP_IDLE,
+	EEP_BUSY /* a write job is running */
+} Eep_StatusType;
+
+/* Result of the last write job */
+typedef enum
+{
+	EEP_JOB_OK,
+	EEP_JOB_FAILED,
+	EEP_JOB_PENDING
+} Eep_JobResultType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for EEP Initialization API, waits for the EEPROM to finish the start-up recovery */
+void Eep_Init(void);
+
+/* Function for EEP Read API, copies Length bytes from the EEPROM at once */
+Std_ReturnType Eep_Read(Eep_AddressType EepromAddress, uint32* DataBufferPtr, Eep_LengthType Length);
+
+/* Function for EEP Write API, starts the write job of Length bytes. The buffer must stay unchanged
+ * until the job ends, only the words that differ from the EEPROM content are programmed. */
+Std_ReturnType Eep_Write(Eep_AddressType EepromAddress, const uint32* DataBufferPtr, Eep_LengthType Length);
+
+/* Function for EEP GetStatus API */
+Eep_StatusType Eep_GetStatus(void);
+
+/* Function for EEP GetJobResult API */
+Eep_JobResultType Eep_GetJobResult(void);
+
+/* Function for EEP MainFunction API, called from a low priority task: it starts at most one word
+ * programming per call and returns at once while the EEPROM is busy */
+void Eep_MainFunction(void);
+
+#if (EEP_VERSION_INFO_API == STD_ON)
+/* Function for EEP Get Version Info API */
+void Eep_GetVersionInfo(Std_VersionInfoType* versioninfo);
+#endif
+
+#endif /* EEP_H */
@@ -0,0 +1,40 @@
+/******************************************************************
+ * @Module   	: Eep
+ * @Title 	 	: EEPROM Driver Pre-Compile Configuration Header File 
+ * @Filename 	: Eep_Cfg.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: 
+ ********************************************************************/
+
+#ifndef EEP_CFG_H
+#define EEP_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define EEP_CFG_SW_MAJOR_VERSION		 (1U)
+#define EEP_CFG_SW_MINOR_VERSION		 (0U)
+#define EEP_CFG_SW_PATCH_VERSION		 (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define EEP_CFG_AR_RELEASE_MAJOR_VERSION (4U)
+#define EEP_CFG_AR_RELEASE_MINOR_VERSION (0U)
+#define EEP_CFG_AR_RELEASE_PATCH_VERSION (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define EEP_DEV_ERROR_DETECT			 (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define EEP_VERSION_INFO_API			 (STD_ON)
+
+/* Size of the internal EEPROM in bytes (32 blocks of 16 words) */
+#define EEP_SIZE						 (2048U)
+
+/* Number of words of a block of the internal EEPROM */
+#define EEP_BLOCK_WORDS					 (16U)
+
+#endif /* EEP_CFG_H */
@@ -0,0 +1,573 @@
+/******************************************************************
+ * @Module   	: Gpt
+ * @Title 	 	: GPT Module Source file
+ * @Filename 	: Gpt.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	: Every channel uses timer A of one 16/32-bit timer module
+ *                configured as a single 32-bit down counter.
+ ********************************************************************/
+
+#include "Gpt.h"
+#include "Peripheral_Regs.h"
+#include "Irq.h"
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+
+	#include "Det.h"
+
+	/* AUTOSAR Version checking between Det and Gpt Modules */
+	#if ((DET_AR_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION) || \
+		 (DET_AR_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION) || \
+		 (DET_AR_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+		#error "The AR version of Det.h does not match the expected version"
+	#endif
+
+#endif
+
+/* Number of 16/32-bit timer modules that can be used by the channels */
+#define GPT_NUMBER_OF_TIMERS (4U)
+
+/* Marks the timers that are not used by any Gpt channel */
+#define GPT_NO_CHANNEL		 (uint8)0xFF
+
+/* GPTMCFG value selecting the 32-bit timer configuration */
+#define GPT_CFG_32_BIT		 (0x00000000U)
+
+/* GPTMTAMR TAMR field values */
+#define GPT_TAMR_ONE_SHOT	 (0x00000001U)
+#define GPT_TAMR_PERIODIC	 (0x00000002U)
+
+/* GPTMCTL TAEN, GPTMIMR TATOIM and GPTMICR TATOCINT bits */
+#define GPT_CTL_TAEN		 (0U)
+#define GPT_INT_TATO		 (0U)
+
+/* State of a channel */
+typedef enum
+{
+	GPT_CHANNEL_INITIALIZED,
+	GPT_CHANNEL_RUNNING,
+	GPT_CHANNEL_STOPPED,
+	GPT_CHANNEL_EXPIRED
+} Gpt_ChannelStateType;
+
+STATIC const Gpt_ConfigChannel* Gpt_Channels = NULL_PTR;
+STATIC uint8					Gpt_Status = GPT_NOT_INITIALIZED;
+
+/* Base address and NVIC interrupt number of timer A of every timer module */
+STATIC const uint32 Gpt_TimerBaseAddress[GPT_NUMBER_OF_TIMERS] = {TIMER0_BASE_ADDRESS, TIMER1_BASE_ADDRESS,
+																	TIMER2_BASE_ADDRESS, TIMER3_BASE_ADDRESS};
+STATIC const uint8	Gpt_TimerIrqNumber[GPT_NUMBER_OF_TIMERS] = {19U, 21U, 23U, 35U};
+
+/* Channel served by every timer module, the ISR resolves its channel in one lookup */
+STATIC uint8 Gpt_TimerChannel[GPT_NUMBER_OF_TIMERS];
+
+STATIC volatile Gpt_ChannelStateType Gpt_ChannelState[GPT_CONFIGURED_CHANNELS];
+
+/* Channels whose notification is enabled, bit n is channel n */
+STATIC volatile uint32 Gpt_NotificationMask;
+
+/************************************************************************************
+* Function Name		: Gpt_TimerIsr
+* Description		: Common time-out handler of all the timer modules. A one-shot channel
+*					  has already been disabled by the hardware when the handler runs.
+************************************************************************************/
+STATIC void Gpt_TimerIsr(uint8 TimerNum)
+{
+	uint8  Channel = Gpt_TimerChannel[TimerNum];
+	uint32 Base = Gpt_TimerBaseAddress[TimerNum];
+
+	/* A time-out cleared by Gpt_StopTimer can leave the interrupt pending in the NVIC when the channel
+	 * is stopped and restarted from an ISR of the same priority, it is ignored */
+	if (!IS_BIT_SET(TIMER_REG(Base, TIMER_O_MIS), GPT_INT_TATO))
+	{
+		/* Do Nothing */
+	}
+	else if (GPT_NO_CHANNEL != Channel)
+	{
+#if (IRQ_INSTRUMENTATION_API == STD_ON)
+		/* A periodic timer reloaded at the time-out, the cycles it counted since are the latency */
+		if (GPT_CH_MODE_ONESHOT != Gpt_Channels[Channel].Mode)
+		{
+			Irq_ReportLatency((Irq_NumberType)Gpt_TimerIrqNumber[TimerNum],
+							  TIMER_REG(Base, TIMER_O_TAILR) - TIMER_REG(Base, TIMER_O_TAR));
+		}
+		else
+		{
+			/* No Action Required */
+		}
+#endif
+
+		TIMER_REG(Base, TIMER_O_ICR) = BIT(GPT_INT_TATO);
+
+		if (GPT_CH_MODE_ONESHOT == Gpt_Channels[Channel].Mode)
+		{
+			Gpt_ChannelState[Channel] = GPT_CHANNEL_EXPIRED;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		if (IS_BIT_SET(Gpt_NotificationMask, Channel) && (NULL_PTR != Gpt_Channels[Channel].Notification))
+		{
+			Gpt_Channels[Channel].Notification();
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Timer A interrupt handlers referenced by the vector table in cstartup_M.c
+ ************************************************************************************/
+void Timer0A_Handler(void)
+{
+	Gpt_TimerIsr(0U);
+}
+
+void Timer1A_Handler(void)
+{
+	Gpt_TimerIsr(1U);
+}
+
+void Timer2A_Handler(void)
+{
+	Gpt_TimerIsr(2U);
+}
+
+void Timer3A_Handler(void)
+{
+	Gpt_TimerIsr(3U);
+}
+
+/* Handler installed for every timer by Gpt_Init */
+STATIC const Irq_HandlerType Gpt_TimerHandler[GPT_NUMBER_OF_TIMERS] = {Timer0A_Handler, Timer1A_Handler,
+																		Timer2A_Handler, Timer3A_Handler};
+
+/************************************************************************************
+ * Service name      : Gpt_Init
+*  Syntax            : void Gpt_Init(const Gpt_ConfigType* ConfigPtr)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x01
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : ConfigPtr - Pointer to post-build configuration data
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to Initialize the Gpt module, the channels are stopped and
+*                      their notifications are disabled.
+ ************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType* ConfigPtr)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+	}
+	else if (GPT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_ALREADY_INITIALIZED);
+	}
+	else
+#endif
+	{
+		uint8 UsedTimers = 0U;
+
+		Gpt_Channels = ConfigPtr->Channels;
+		Gpt_NotificationMask = 0U;
+
+		for (uint8 TimerNum = 0U; TimerNum < GPT_NUMBER_OF_TIMERS; TimerNum++)
+		{
+			Gpt_TimerChannel[TimerNum] = GPT_NO_CHANNEL;
+		}
+
+		for (Gpt_ChannelType Channel = 0U; Channel < GPT_CONFIGURED_CHANNELS; Channel++)
+		{
+			SET_BIT(UsedTimers, Gpt_Channels[Channel].Timer_Num);
+			Gpt_TimerChannel[Gpt_Channels[Channel].Timer_Num] = Channel;
+		}
+
+		/* Enable the clock of all the used timers in one write */
+		SET_MASK(RCGCTIMER, UsedTimers);
+
+		while ((PRTIMER & UsedTimers) != UsedTimers)
+		{
+			/* Do Nothing */
+		}
+
+		for (Gpt_ChannelType Channel = 0U; Channel < GPT_CONFIGURED_CHANNELS; Channel++)
+		{
+			uint8  TimerNum = Gpt_Channels[Channel].Timer_Num;
+			uint32 Base = Gpt_TimerBaseAddress[TimerNum];
+			uint8  Irq = Gpt_TimerIrqNumber[TimerNum];
+
+			/* Timer disabled while it is configured, down counting, time-out interrupt unmasked */
+			TIMER_REG(Base, TIMER_O_CTL) = 0U;
+			TIMER_REG(Base, TIMER_O_CFG) = GPT_CFG_32_BIT;
+			TIMER_REG(Base, TIMER_O_TAMR) =
+				(GPT_CH_MODE_ONESHOT == Gpt_Channels[Channel].Mode) ? GPT_TAMR_ONE_SHOT : GPT_TAMR_PERIODIC;
+			TIMER_REG(Base, TIMER_O_ICR) = BIT(GPT_INT_TATO);
+			TIMER_REG(Base, TIMER_O_IMR) = BIT(GPT_INT_TATO);
+
+			(void)Irq_Install((Irq_NumberType)Irq, Gpt_TimerHandler[TimerNum], GPT_INTERRUPT_PRIORITY);
+
+			Gpt_ChannelState[Channel] = GPT_CHANNEL_INITIALIZED;
+		}
+
+		Gpt_Status = GPT_INITIALIZED;
+	}
+}
+
+/************************************************************************************
+ * Service name      : Gpt_StartTimer
+*  Syntax            : void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x05
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant (limited according to GPT084)
+*  Parameters (in)   : Channel - Numeric identifier of the GPT channel
+*                      Value - Target time in number of ticks
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to start a channel that expires after Value ticks
+ ************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value)
+{
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (GPT_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the value can be loaded in the 32-bit timer */
+	if (0U == Value)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_PARAM_VALUE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the channel is already running (valid channel and initialized driver only) */
+	if ((FALSE == error) && (GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel]))
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_BUSY);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if (FALSE == error)
+	{
+		uint32 Base = Gpt_TimerBaseAddress[Gpt_Channels[Channel].Timer_Num];
+
+		/* The timer reloads GPTMTAILR when it is enabled, it expires when it reaches 0 */
+		TIMER_REG(Base, TIMER_O_TAILR) = Value - 1U;
+		TIMER_REG(Base, TIMER_O_ICR) = BIT(GPT_INT_TATO);
+		Gpt_ChannelState[Channel] = GPT_CHANNEL_RUNNING;
+		SET_BIT(TIMER_REG(Base, TIMER_O_CTL), GPT_CTL_TAEN);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Service name      : Gpt_StopTimer
+*  Syntax            : void Gpt_StopTimer(Gpt_ChannelType Channel)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x06
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant (limited according to GPT085)
+*  Parameters (in)   : Channel - Numeric identifier of the GPT channel
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to stop a channel, nothing is done if it is not running
+ ************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel)
+{
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_STOP_TIMER_SID, GPT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (GPT_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_STOP_TIMER_SID, GPT_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if ((FALSE == error) && (GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel]))
+	{
+		uint32 Base = Gpt_TimerBaseAddress[Gpt_Channels[Channel].Timer_Num];
+
+		CLEAR_BIT(TIMER_REG(Base, TIMER_O_CTL), GPT_CTL_TAEN);
+		TIMER_REG(Base, TIMER_O_ICR) = BIT(GPT_INT_TATO);
+		Gpt_ChannelState[Channel] = GPT_CHANNEL_STOPPED;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/************************************************************************************
+ * Service name      : Gpt_GetTimeElapsed
+*  Syntax            : Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x03
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : Channel - Numeric identifier of the GPT channel
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : Gpt_ValueType - Elapsed timer ticks since the channel was (re)started,
+*                      the full target time for an expired one-shot channel
+*  Description       : Function to return the time already elapsed
+ ************************************************************************************/
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel)
+{
+	Gpt_ValueType Elapsed = 0U;
+	boolean		  error = FALSE;
+
+	#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_TIME_ELAPSED_SID, GPT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (GPT_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_TIME_ELAPSED_SID, GPT_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	#endif
+
+	if ((FALSE == error) && (GPT_CHANNEL_INITIALIZED != Gpt_ChannelState[Channel]))
+	{
+		uint32 Base = Gpt_TimerBaseAddress[Gpt_Channels[Channel].Timer_Num];
+		uint32 Load = TIMER_REG(Base, TIMER_O_TAILR);
+
+		/* A time-out not handled yet by the ISR counts as expired */
+		if ((GPT_CHANNEL_EXPIRED == Gpt_ChannelState[Channel]) ||
+			((GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel]) &&
+			 (GPT_CH_MODE_ONESHOT == Gpt_Channels[Channel].Mode) &&
+			 IS_BIT_SET(TIMER_REG(Base, TIMER_O_RIS), GPT_INT_TATO)))
+		{
+			Elapsed = Load + 1U;
+		}
+		else
+		{
+			/* The counter counts down from the load value */
+			Elapsed = Load - TIMER_REG(Base, TIMER_O_TAR);
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Elapsed;
+}
+#endif
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+ * Service name      : Gpt_EnableNotification
+*  Syntax            : void Gpt_EnableNotification(Gpt_ChannelType Channel)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x07
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant (limited according to GPT086)
+*  Parameters (in)   : Channel - Numeric identifier of the GPT channel
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to call the configured notification at every expiry of a channel
+ ************************************************************************************/
+void Gpt_EnableNotification(Gpt_ChannelType Channel)
+{
+	boolean error = FALSE;
+
+	#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_ENABLE_NOTIFICATION_SID, GPT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (GPT_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_ENABLE_NOTIFICATION_SID, GPT_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	#endif
+
+	if (FALSE == error)
+	{
+		ATOMIC_SET_BIT(Gpt_NotificationMask, Channel);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Service name      : Gpt_DisableNotification
+*  Syntax            : void Gpt_DisableNotification(Gpt_ChannelType Channel)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x08
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant (limited according to GPT087)
+*  Parameters (in)   : Channel - Numeric identifier of the GPT channel
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to stop calling the notification of a channel
+ ************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel)
+{
+	boolean error = FALSE;
+
+	#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DISABLE_NOTIFICATION_SID, GPT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (GPT_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DISABLE_NOTIFICATION_SID, GPT_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	#endif
+
+	if (FALSE == error)
+	{
+		ATOMIC_CLEAR_BIT(Gpt_NotificationMask, Channel);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+#if (GPT_VERSION_INFO_API == STD_ON)
+/************************************************************************************
+ * Service name      : Gpt_GetVersionInfo
+*  Syntax            : void Gpt_GetVersionInfo(Std_VersionInfoType* versioninfo)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x00
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : versioninfo - Pointer to where to store the version information of this module.
+*  Return value      : None
+*  Description       : Function to get the version information of this module.
+ ************************************************************************************/
+void Gpt_GetVersionInfo(Std_VersionInfoType* versioninfo)
+{
+	#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_VERSION_INFO_SID, GPT_E_PARAM_POINTER);
+	}
+	else
+	#endif /* (GPT_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)GPT_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)GPT_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)GPT_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)GPT_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)GPT_SW_PATCH_VERSION;
+	}
+}
+#endif
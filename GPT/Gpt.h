@@ -0,0 +1,200 @@
+/******************************************************************
+ * @Module   	: Gpt
+ * @Title 	 	: GPT Module Header File
+ * @Filename 	: Gpt.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: One-shot and continuous timers on the 16/32-bit general-purpose
+ *                timers (timer A in 32-bit mode), counting the system clock.
+ ********************************************************************/
+
+#ifndef GPT_H
+#define GPT_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define GPT_VENDOR_ID				 (1000U)
+
+/* Gpt Module Id */
+#define GPT_MODULE_ID				 (100U)
+
+/* Gpt Instance Id */
+#define GPT_INSTANCE_ID				 (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_SW_MAJOR_VERSION		 (1U)
+#define GPT_SW_MINOR_VERSION		 (0U)
+#define GPT_SW_PATCH_VERSION		 (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_AR_RELEASE_MAJOR_VERSION (4U)
+#define GPT_AR_RELEASE_MINOR_VERSION (0U)
+#define GPT_AR_RELEASE_PATCH_VERSION (3U)
+
+/*
+ * Macros for Gpt Status
+ */
+#define GPT_INITIALIZED				 (1U)
+#define GPT_NOT_INITIALIZED			 (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Gpt Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Gpt Pre-Compile Configuration Header file */
+#include "Gpt_Cfg.h"
+
+/* AUTOSAR Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION) || \
+	 (GPT_CFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION) || \
+	 (GPT_CFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION) || \
+	 (GPT_CFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION) || \
+	 (GPT_CFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+	#error "The SW version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for GPT GetVersionInfo */
+#define GPT_GET_VERSION_INFO_SID	 (uint8)0x00
+
+/* Service ID for GPT Init */
+#define GPT_INIT_SID				 (uint8)0x01
+
+/* Service ID for GPT get Time Elapsed */
+#define GPT_GET_TIME_ELAPSED_SID	 (uint8)0x03
+
+/* Service ID for GPT start Timer */
+#define GPT_START_TIMER_SID			 (uint8)0x05
+
+/* Service ID for GPT stop Timer */
+#define GPT_STOP_TIMER_SID			 (uint8)0x06
+
+/* Service ID for GPT enable Notification */
+#define GPT_ENABLE_NOTIFICATION_SID	 (uint8)0x07
+
+/* Service ID for GPT disable Notification */
+#define GPT_DISABLE_NOTIFICATION_SID (uint8)0x08
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* DET code to report that an API service is called without module initialization */
+#define GPT_E_UNINIT				 (uint8)0x0A
+
+/* DET code to report that Gpt_StartTimer is called on a running channel */
+#define GPT_E_BUSY					 (uint8)0x0B
+
+/* DET code to report that Gpt_Init is called while the driver is already initialized */
+#define GPT_E_ALREADY_INITIALIZED	 (uint8)0x0D
+
+/* DET code to report Invalid Channel */
+#define GPT_E_PARAM_CHANNEL			 (uint8)0x14
+
+/* DET code to report an invalid timeout value (0 or above 32 bits) */
+#define GPT_E_PARAM_VALUE			 (uint8)0x15
+
+/* DET code to report that an API service is called with a NULL pointer parameter */
+#define GPT_E_PARAM_POINTER			 (uint8)0x16
+
+/* Gpt_Init API service called with NULL pointer parameter */
+#define GPT_E_PARAM_CONFIG			 (uint8)0x0E
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Gpt_ChannelType used by the GPT APIs */
+typedef uint8 Gpt_ChannelType;
+
+/* Type definition for Gpt_ValueType, a number of timer ticks (system clock cycles) */
+typedef uint32 Gpt_ValueType;
+
+/* Enumeration for Gpt_ChannelModeType used by the GPT APIs */
+typedef enum
+{
+	GPT_CH_MODE_CONTINUOUS, /* the timer restarts after every expiry */
+	GPT_CH_MODE_ONESHOT		/* the timer stops after its first expiry */
+} Gpt_ChannelModeType;
+
+/* Type definition for the channel notification, called from the timer interrupt at expiry */
+typedef void (*Gpt_NotifyFunctionType)(void);
+
+typedef struct
+{
+	/* Member contains the number of the 16/32-bit timer module (TIMER0 to TIMER3) */
+	uint8 Timer_Num;
+	/* Member contains the mode of the channel */
+	Gpt_ChannelModeType Mode;
+	/* Member contains the function called on every expiry (NULL_PTR for none) */
+	Gpt_NotifyFunctionType Notification;
+} Gpt_ConfigChannel;
+
+/* Data Structure required for initializing the Gpt Driver */
+typedef struct Gpt_ConfigType
+{
+	Gpt_ConfigChannel Channels[GPT_CONFIGURED_CHANNELS];
+} Gpt_ConfigType;
+
+/* Number of timer ticks in US micro-seconds */
+#define GPT_US_TO_TICKS(US) ((Gpt_ValueType)(((uint32)(US) * (GPT_CLOCK_FREQUENCY_HZ / 1000000U))))
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for GPT Initialization API */
+void Gpt_Init(const Gpt_ConfigType* ConfigPtr);
+
+/* Function for GPT start Timer API, the channel expires after Value ticks */
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value);
+
+/* Function for GPT stop Timer API */
+void Gpt_StopTimer(Gpt_ChannelType Channel);
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/* Function for GPT get Time Elapsed API, ticks since the channel was (re)started */
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel);
+#endif
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/* Function for GPT enable Notification API */
+void Gpt_EnableNotification(Gpt_ChannelType Channel);
+
+/* Function for GPT disable Notification API */
+void Gpt_DisableNotification(Gpt_ChannelType Channel);
+#endif
+
+#if (GPT_VERSION_INFO_API == STD_ON)
+/* Function for GPT Get Version Info API */
+void Gpt_GetVersionInfo(Std_VersionInfoType* versioninfo);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Gpt and other modules */
+extern const Gpt_ConfigType Gpt_Configuration;
+
+#endif /* GPT_H */
@@ -0,0 +1,65 @@
+/******************************************************************
+ * @Module   	: Gpt
+ * @Title 	 	: GPT Pre-Compile Configuration Header File 
+ * @Filename 	: Gpt_Cfg.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: 
+ ********************************************************************/
+
+#ifndef GPT_CFG_H
+#define GPT_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_CFG_SW_MAJOR_VERSION			 (1U)
+#define GPT_CFG_SW_MINOR_VERSION			 (0U)
+#define GPT_CFG_SW_PATCH_VERSION			 (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_CFG_AR_RELEASE_MAJOR_VERSION	 (4U)
+#define GPT_CFG_AR_RELEASE_MINOR_VERSION	 (0U)
+#define GPT_CFG_AR_RELEASE_PATCH_VERSION	 (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define GPT_DEV_ERROR_DETECT				 (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define GPT_VERSION_INFO_API				 (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeElapsed API */
+#define GPT_TIME_ELAPSED_API				 (STD_ON)
+
+/* Pre-compile option for presence of Gpt_EnableNotification and Gpt_DisableNotification APIs */
+#define GPT_ENABLE_DISABLE_NOTIFICATION_API	 (STD_ON)
+
+/* Clock of the timers (system clock), one tick of a channel is one clock cycle */
+#define GPT_CLOCK_FREQUENCY_HZ				 (16000000U)
+
+/* Priority of the timer interrupts used by the Gpt channels (0 - 7), same as the Icu interrupts so
+ * that the button edge and sampling handlers never preempt each other */
+#define GPT_INTERRUPT_PRIORITY				 (2U)
+
+/* Number of the configured Gpt Channels */
+#define GPT_CONFIGURED_CHANNELS				 (3U)
+
+/* Channel Index in the array of structures in Gpt_PBcfg.c */
+#define GptConf_BUTTON_CHANNEL_ID_INDEX		 (Gpt_ChannelType)0
+#define GptConf_LED_CHANNEL_ID_INDEX		 (Gpt_ChannelType)1
+#define GptConf_LED_PATTERN_CHANNEL_ID_INDEX (Gpt_ChannelType)2
+
+/* 16/32-bit timer module of every channel (TIMER0 to TIMER3), the timers run in 32-bit mode */
+#define GptConf_BUTTON_TIMER_NUM			 (uint8)0 /* TIMER0 */
+#define GptConf_LED_TIMER_NUM				 (uint8)1 /* TIMER1 */
+#define GptConf_LED_PATTERN_TIMER_NUM		 (uint8)2 /* TIMER2 */
+
+/* Mode of every channel */
+#define GptConf_BUTTON_CHANNEL_MODE			 (Gpt_ChannelModeType) GPT_CH_MODE_ONESHOT
+#define GptConf_LED_CHANNEL_MODE			 (Gpt_ChannelModeType) GPT_CH_MODE_CONTINUOUS
+#define GptConf_LED_PATTERN_CHANNEL_MODE	 (Gpt_ChannelModeType) GPT_CH_MODE_ONESHOT
+
+#endif /* GPT_CFG_H */
@@ -0,0 +1,86 @@
+/******************************************************************
+ * @Module   	: Gpt
+ * @Title 	 	: GPT Post Build Configuration Source file
+ * @Filename 	: Gpt_PBcfg.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: 
+ ********************************************************************/
+
+#include "Gpt.h"
+#include "Button.h"
+#include "Led.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_PBCFG_SW_MAJOR_VERSION		   (1U)
+#define GPT_PBCFG_SW_MINOR_VERSION		   (0U)
+#define GPT_PBCFG_SW_PATCH_VERSION		   (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_PBCFG_AR_RELEASE_MAJOR_VERSION (4U)
+#define GPT_PBCFG_AR_RELEASE_MINOR_VERSION (0U)
+#define GPT_PBCFG_AR_RELEASE_PATCH_VERSION (3U)
+
+/* AUTOSAR Version checking between Gpt_PBcfg.c and Gpt.h files */
+#if ((GPT_PBCFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION) || \
+	 (GPT_PBCFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION) || \
+	 (GPT_PBCFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Gpt_PBcfg.c and Gpt.h files */
+#if ((GPT_PBCFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION) || \
+	 (GPT_PBCFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION) || \
+	 (GPT_PBCFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+	#error "The SW version of PBcfg.c does not match the expected version"
+#endif
+/* The button channel samples the switches of the Button module in edge trigger mode */
+#if (BUTTON_EDGE_TRIGGER == STD_ON)
+	#define GPT_BUTTON_NOTIFICATION BUTTON_sampleNotification
+#else
+	#define GPT_BUTTON_NOTIFICATION NULL_PTR
+#endif
+
+/* The led channel steps the fades of the Led module */
+#if (LED_PWM_API == STD_ON)
+	#define GPT_LED_NOTIFICATION LED_fadeNotification
+#else
+	#define GPT_LED_NOTIFICATION NULL_PTR
+#endif
+
+/* The led pattern channel expires at the next transition of the Led patterns */
+#define GPT_LED_PATTERN_NOTIFICATION LED_patternNotification
+
+/* PB structure used with Gpt_Init API */
+const Gpt_ConfigType Gpt_Configuration = {
+
+	.Channels =
+		{
+
+			[GptConf_BUTTON_CHANNEL_ID_INDEX] =
+				{
+					.Timer_Num = GptConf_BUTTON_TIMER_NUM,
+					.Mode = GptConf_BUTTON_CHANNEL_MODE,
+					.Notification = GPT_BUTTON_NOTIFICATION,
+				},
+			[GptConf_LED_CHANNEL_ID_INDEX] =
+				{
+					.Timer_Num = GptConf_LED_TIMER_NUM,
+					.Mode = GptConf_LED_CHANNEL_MODE,
+					.Notification = GPT_LED_NOTIFICATION,
+				},
+			[GptConf_LED_PATTERN_CHANNEL_ID_INDEX] =
+				{
+					.Timer_Num = GptConf_LED_PATTERN_TIMER_NUM,
+					.Mode = GptConf_LED_PATTERN_CHANNEL_MODE,
+					.Notification = GPT_LED_PATTERN_NOTIFICATION,
+				}
+
+		}
+
+};
@@ -10,22 +10,8 @@
 #include "sysTick.h"
 #include "SysTick_reg.h"
 
-/* Global pointer to function used to point upper layer functions
- * to be used in Call Back */
-static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
-
-/**
- * The SysTick_Handler function checks if a callback function has been set and calls it if it has.
- */
-void SysTick_Handler(void)
-{
-	/* Check if the Timer0_setCallBack is already called */
-	if (g_SysTick_Call_Back_Ptr != NULL_PTR)
-	{
-		(*g_SysTick_Call_Back_Ptr)(); /* call the function in the scheduler using call-back concept */
-	}
-	/* No need to clear the trigger flag (COUNT) bit ... it cleared automatically by the HW */
-}
+/* The SysTick handler is not part of this driver: the Os installs its tick function directly in the
+ * vector table with Irq_Install */
 
 /**
  * @brief Initialize the SysTick timer with the specified configuration.
@@ -122,9 +108,4 @@ void SysTick_disableException(void)
 	 * 0: Disable
 	 * 1: Enable */
 	STCTRL.bits.INTEN = 0;
-}
-
-void SysTick_SetCallBack(void (*Ptr2Func)(void))
-{
-	g_SysTick_Call_Back_Ptr = Ptr2Func;
 }
\ No newline at end of file
@@ -37,7 +37,6 @@ void SysTick_init(const SysTick_ConfigType* Config_Ptr, uint32 N);
 void SysTick_SetPriority(uint8 ExceptionPriority);
 void SysTick_enableException(void);
 void SysTick_disableException(void);
-void SysTick_SetCallBack(void (*Ptr2Func)(void));
 
 /* Global configuration structure to be used by the user to set the systick configuration */
 extern const SysTick_ConfigType SysTick_Configuration;
@@ -0,0 +1,717 @@
+/******************************************************************
+ * @Module   	: Icu
+ * @Title 	 	: ICU Module Source file
+ * @Filename 	: Icu.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	: The pins are expected to be configured as digital inputs by the Port driver
+ *                before Icu_Init is called.
+ ********************************************************************/
+
+#include "Icu.h"
+#include "Peripheral_Regs.h"
+#include "Irq.h"
+#include "Dwt.h"
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+
+	#include "Det.h"
+
+	/* AUTOSAR Version checking between Det and Icu Modules */
+	#if ((DET_AR_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION) || \
+		 (DET_AR_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION) || \
+		 (DET_AR_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+		#error "The AR version of Det.h does not match the expected version"
+	#endif
+
+#endif
+
+/* Marks the pins of a port that are not used by any Icu channel */
+#define ICU_NO_CHANNEL		 (uint8)0xFF
+
+/* Number of pins in every GPIO port */
+#define ICU_PINS_PER_PORT	 (8U)
+
+STATIC const Icu_ConfigChannel* Icu_Channels = NULL_PTR;
+STATIC uint8					Icu_Status = ICU_NOT_INITIALIZED;
+
+/* NVIC interrupt number of every GPIO port (PORTF is not contiguous with the others) */
+STATIC const uint8 Icu_PortIrqNumber[NUMBER_OF_PORTS] = {0U, 1U, 2U, 3U, 4U, 30U};
+
+/* Channel served by every pin of every port, the ISR resolves a pending pin in one lookup */
+STATIC uint8 Icu_PinChannel[NUMBER_OF_PORTS][ICU_PINS_PER_PORT];
+
+/* Pins of every port that carry an Icu channel, the ISR only dispatches these */
+STATIC uint8 Icu_ChannelPins[NUMBER_OF_PORTS];
+
+/* Pins of every port whose notification is enabled */
+STATIC volatile uint8 Icu_NotificationMask[NUMBER_OF_PORTS];
+
+/* Pins of every port that saw an edge since the last Icu_GetInputState call */
+STATIC volatile uint8 Icu_ActiveMask[NUMBER_OF_PORTS];
+
+/* DWT cycle count captured at the last edge of every channel */
+STATIC volatile Icu_TimestampType Icu_EdgeTimestamp[ICU_CONFIGURED_CHANNELS];
+
+/************************************************************************************
+* Function Name		: Icu_ApplyActivation
+* Description		: Writes the edge selection of one pin in the IS/IBE/IEV registers, the pin
+*					  interrupt is masked while the sense is changed and its stale flag is cleared
+*					  so that the reconfiguration itself can not raise a notification.
+************************************************************************************/
+STATIC void Icu_ApplyActivation(uint8 PortId, uint8 PinId, Icu_ActivationType Activation)
+{
+	volatile GPIO_RegType* Regs = GPIO_PORT(PortId);
+	boolean				   PinUnmasked = (boolean)READ_BIT(Regs->IM, PinId);
+
+	ATOMIC_CLEAR_BIT(Regs->IM, PinId);
+
+	/* Edge sensitive */
+	CLEAR_BIT(Regs->IS, PinId);
+
+	if (ICU_BOTH_EDGES == Activation)
+	{
+		SET_BIT(Regs->IBE, PinId);
+	}
+	else
+	{
+		CLEAR_BIT(Regs->IBE, PinId);
+
+		if (ICU_RISING_EDGE == Activation)
+		{
+			SET_BIT(Regs->IEV, PinId);
+		}
+		else
+		{
+			CLEAR_BIT(Regs->IEV, PinId);
+		}
+	}
+
+	Regs->ICR = BIT(PinId);
+
+	if (TRUE == PinUnmasked)
+	{
+		ATOMIC_SET_BIT(Regs->IM, PinId);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Function Name		: Icu_PortIsr
+* Description		: Common body of the GPIO port handlers. The masked status is read and
+*					  acknowledged once, then the pending pins that carry a channel are dispatched
+*					  from the highest one down using CLZ, so the cost depends on the number of
+*					  edges and not on the number of pins. All the edges of one interrupt share
+*					  its timestamp.
+************************************************************************************/
+STATIC void Icu_PortIsr(uint8 PortId)
+{
+	Icu_TimestampType	   Timestamp = DWT_GET_CYCLES();
+	volatile GPIO_RegType* Regs = GPIO_PORT(PortId);
+	uint32				   Status = Regs->MIS;
+	uint32				   Pending = Status & Icu_ChannelPins[PortId];
+
+	/* Edges arriving while dispatching set the flags again and re-pend the interrupt. The flags of
+	 * pins without a channel are cleared too, or the interrupt would never end. */
+	Regs->ICR = Status;
+
+	Icu_ActiveMask[PortId] |= (uint8)Pending;
+
+	while (0U != Pending)
+	{
+		uint8			PinId = (uint8)(31U - COUNT_LEADING_ZEROS(Pending));
+		Icu_ChannelType Channel = Icu_PinChannel[PortId][PinId];
+
+		CLEAR_BIT(Pending, PinId);
+
+		Icu_EdgeTimestamp[Channel] = Timestamp;
+
+		if (IS_BIT_SET(Icu_NotificationMask[PortId], PinId) && (NULL_PTR != Icu_Channels[Channel].Notification))
+		{
+			Icu_Channels[Channel].Notification(Channel);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+}
+
+/************************************************************************************
+ * GPIO port interrupt handlers (vectors 16 - 20 and 46)
+ ************************************************************************************/
+void GPIOPortA_Handler(void)
+{
+	Icu_PortIsr(PORTA);
+}
+
+void GPIOPortB_Handler(void)
+{
+	Icu_PortIsr(PORTB);
+}
+
+void GPIOPortC_Handler(void)
+{
+	Icu_PortIsr(PORTC);
+}
+
+void GPIOPortD_Handler(void)
+{
+	Icu_PortIsr(PORTD);
+}
+
+void GPIOPortE_Handler(void)
+{
+	Icu_PortIsr(PORTE);
+}
+
+void GPIOPortF_Handler(void)
+{
+	Icu_PortIsr(PORTF);
+}
+
+/* Handler installed for every port that carries a channel by Icu_Init */
+STATIC const Irq_HandlerType Icu_PortHandler[NUMBER_OF_PORTS] = {GPIOPortA_Handler, GPIOPortB_Handler,
+																  GPIOPortC_Handler, GPIOPortD_Handler,
+																  GPIOPortE_Handler, GPIOPortF_Handler};
+
+/************************************************************************************
+* Function Name		: Icu_IsConfigValid
+* Description		: Checks that every channel names an existing port and pin, Icu_Init indexes
+*					  Icu_PinChannel with them.
+************************************************************************************/
+STATIC boolean Icu_IsConfigValid(const Icu_ConfigChannel* Channels)
+{
+	boolean Valid = TRUE;
+
+	for (Icu_ChannelType Channel = STD_LOW; Channel < ICU_CONFIGURED_CHANNELS; Channel++)
+	{
+		if ((Channels[Channel].Port_Num >= NUMBER_OF_PORTS) || (Channels[Channel].Pin_Num >= ICU_PINS_PER_PORT))
+		{
+			Valid = FALSE;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+
+	return Valid;
+}
+
+/************************************************************************************
+*  Service name      : Icu_Init
+*  Syntax            : void Icu_Init(const Icu_ConfigType* ConfigPtr)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x00
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non Reentrant
+*  Parameters (in)   : ConfigPtr - Pointer to post-build configuration data
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to Initialize the Icu module, the default edge of every channel is
+*					   selected and the port interrupts are enabled in the NVIC. The pins stay
+*					   masked until Icu_EnableEdgeDetection is called and the notifications are
+*					   disabled until Icu_EnableNotification is called.
+ ************************************************************************************/
+void Icu_Init(const Icu_ConfigType* ConfigPtr)
+{
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_INIT_SID, ICU_E_PARAM_CONFIG);
+	}
+	else
+#endif
+	if (FALSE == Icu_IsConfigValid(ConfigPtr->Channels))
+	{
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_INIT_SID, ICU_E_PARAM_CONFIG);
+#endif
+	}
+	else
+	{
+		uint8 UsedPorts = STD_LOW;
+
+		Icu_Channels = ConfigPtr->Channels;
+
+		/* Timestamps are taken from the free running cycle counter */
+		DWT_CYCLE_COUNTER_ENABLE();
+
+		for (uint8 PortId = STD_LOW; PortId < NUMBER_OF_PORTS; PortId++)
+		{
+			for (uint8 PinId = STD_LOW; PinId < ICU_PINS_PER_PORT; PinId++)
+			{
+				Icu_PinChannel[PortId][PinId] = ICU_NO_CHANNEL;
+			}
+
+			Icu_ChannelPins[PortId] = STD_LOW;
+			Icu_NotificationMask[PortId] = STD_LOW;
+			Icu_ActiveMask[PortId] = STD_LOW;
+		}
+
+		for (Icu_ChannelType Channel = STD_LOW; Channel < ICU_CONFIGURED_CHANNELS; Channel++)
+		{
+			uint8 PortId = Icu_Channels[Channel].Port_Num;
+			uint8 PinId = Icu_Channels[Channel].Pin_Num;
+
+			Icu_PinChannel[PortId][PinId] = Channel;
+			SET_BIT(Icu_ChannelPins[PortId], PinId);
+			Icu_EdgeTimestamp[Channel] = STD_LOW;
+
+			Icu_ApplyActivation(PortId, PinId, Icu_Channels[Channel].Default_Start_Edge);
+
+			SET_BIT(UsedPorts, PortId);
+		}
+
+		/* Only the ports that carry a channel get their interrupt enabled */
+		for (uint8 PortId = STD_LOW; PortId < NUMBER_OF_PORTS; PortId++)
+		{
+			if (IS_BIT_SET(UsedPorts, PortId))
+			{
+				(void)Irq_Install((Irq_NumberType)Icu_PortIrqNumber[PortId], Icu_PortHandler[PortId],
+								  ICU_INTERRUPT_PRIORITY);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		Icu_Status = ICU_INITIALIZED;
+	}
+}
+
+/************************************************************************************
+*  Service name      : Icu_SetActivationCondition
+*  Syntax            : void Icu_SetActivationCondition(Icu_ChannelType Channel,
+*                                                      Icu_ActivationType Activation)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x04
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant (limited according to ICU050)
+*  Parameters (in)   : Channel - Numeric identifier of the ICU channel
+*                      Activation - Type of activation
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to set the edge(s) detected on a channel
+ ************************************************************************************/
+void Icu_SetActivationCondition(Icu_ChannelType Channel, Icu_ActivationType Activation)
+{
+	boolean error = FALSE;
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (ICU_NOT_INITIALIZED == Icu_Status)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_SET_ACTIVATION_CONDITION_SID, ICU_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (ICU_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_SET_ACTIVATION_CONDITION_SID, ICU_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the activation is one of the supported edges */
+	if (ICU_BOTH_EDGES < Activation)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_SET_ACTIVATION_CONDITION_SID, ICU_E_PARAM_ACTIVATION);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if (FALSE == error)
+	{
+		Icu_ApplyActivation(Icu_Channels[Channel].Port_Num, Icu_Channels[Channel].Pin_Num, Activation);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+*  Service name      : Icu_DisableNotification
+*  Syntax            : void Icu_DisableNotification(Icu_ChannelType Channel)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x05
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant (limited according to ICU050)
+*  Parameters (in)   : Channel - Numeric identifier of the ICU channel
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to stop calling the notification of a channel, edges are still
+*					   timestamped while the edge detection is enabled
+ ************************************************************************************/
+void Icu_DisableNotification(Icu_ChannelType Channel)
+{
+	boolean error = FALSE;
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (ICU_NOT_INITIALIZED == Icu_Status)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_DISABLE_NOTIFICATION_SID, ICU_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (ICU_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_DISABLE_NOTIFICATION_SID, ICU_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if (FALSE == error)
+	{
+		ATOMIC_CLEAR_BIT(Icu_NotificationMask[Icu_Channels[Channel].Port_Num], Icu_Channels[Channel].Pin_Num);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+*  Service name      : Icu_EnableNotification
+*  Syntax            : void Icu_EnableNotification(Icu_ChannelType Channel)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x06
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant (limited according to ICU050)
+*  Parameters (in)   : Channel - Numeric identifier of the ICU channel
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to call the configured notification on every edge of a channel
+ ************************************************************************************/
+void Icu_EnableNotification(Icu_ChannelType Channel)
+{
+	boolean error = FALSE;
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (ICU_NOT_INITIALIZED == Icu_Status)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_ENABLE_NOTIFICATION_SID, ICU_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (ICU_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_ENABLE_NOTIFICATION_SID, ICU_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if (FALSE == error)
+	{
+		ATOMIC_SET_BIT(Icu_NotificationMask[Icu_Channels[Channel].Port_Num], Icu_Channels[Channel].Pin_Num);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+*  Service name      : Icu_GetInputState
+*  Syntax            : Icu_InputStateType Icu_GetInputState(Icu_ChannelType Channel)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x08
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : Channel - Numeric identifier of the ICU channel
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : Icu_InputStateType - ICU_ACTIVE if an edge was detected since the last call
+*  Description       : Function to poll the edge status of a channel, the status is cleared by the call
+ ************************************************************************************/
+Icu_InputStateType Icu_GetInputState(Icu_ChannelType Channel)
+{
+	Icu_InputStateType InputState = ICU_IDLE;
+	boolean			   error = FALSE;
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (ICU_NOT_INITIALIZED == Icu_Status)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_GET_INPUT_STATE_SID, ICU_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (ICU_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_GET_INPUT_STATE_SID, ICU_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if (FALSE == error)
+	{
+		uint8 PortId = Icu_Channels[Channel].Port_Num;
+		uint8 PinId = Icu_Channels[Channel].Pin_Num;
+
+		if (IS_BIT_SET(Icu_ActiveMask[PortId], PinId))
+		{
+			ATOMIC_CLEAR_BIT(Icu_ActiveMask[PortId], PinId);
+			InputState = ICU_ACTIVE;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return InputState;
+}
+
+/************************************************************************************
+*  Service name      : Icu_EnableEdgeDetection
+*  Syntax            : void Icu_EnableEdgeDetection(Icu_ChannelType Channel)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x16
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant (limited according to ICU050)
+*  Parameters (in)   : Channel - Numeric identifier of the ICU channel
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to unmask the pin interrupt of a channel, an edge latched while the
+*					   pin was masked is discarded first
+ ************************************************************************************/
+void Icu_EnableEdgeDetection(Icu_ChannelType Channel)
+{
+	boolean error = FALSE;
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (ICU_NOT_INITIALIZED == Icu_Status)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_ENABLE_EDGE_DETECTION_SID, ICU_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (ICU_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_ENABLE_EDGE_DETECTION_SID, ICU_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if (FALSE == error)
+	{
+		uint8 PortId = Icu_Channels[Channel].Port_Num;
+		uint8 PinId = Icu_Channels[Channel].Pin_Num;
+
+		GPIO_PORT(PortId)->ICR = BIT(PinId);
+		ATOMIC_SET_BIT(GPIO_PORT(PortId)->IM, PinId);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+*  Service name      : Icu_DisableEdgeDetection
+*  Syntax            : void Icu_DisableEdgeDetection(Icu_ChannelType Channel)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x17
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant (limited according to ICU050)
+*  Parameters (in)   : Channel - Numeric identifier of the ICU channel
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to mask the pin interrupt of a channel
+ ************************************************************************************/
+void Icu_DisableEdgeDetection(Icu_ChannelType Channel)
+{
+	boolean error = FALSE;
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (ICU_NOT_INITIALIZED == Icu_Status)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_DISABLE_EDGE_DETECTION_SID, ICU_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (ICU_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_DISABLE_EDGE_DETECTION_SID, ICU_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if (FALSE == error)
+	{
+		ATOMIC_CLEAR_BIT(GPIO_PORT(Icu_Channels[Channel].Port_Num)->IM, Icu_Channels[Channel].Pin_Num);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+*  Service name      : Icu_GetEdgeTimestamp
+*  Syntax            : Icu_TimestampType Icu_GetEdgeTimestamp(Icu_ChannelType Channel)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x20
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : Channel - Numeric identifier of the ICU channel
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : Icu_TimestampType - DWT cycle count taken on entry of the ISR that served the
+*					   last edge of the channel (0 if no edge was detected yet)
+*  Description       : Function to read the timestamp of the last edge of a channel. Not an AUTOSAR
+*					   service, the AUTOSAR timestamp API needs a capture timer per channel.
+ ************************************************************************************/
+Icu_TimestampType Icu_GetEdgeTimestamp(Icu_ChannelType Channel)
+{
+	Icu_TimestampType Timestamp = STD_LOW;
+	boolean			  error = FALSE;
+
+#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (ICU_NOT_INITIALIZED == Icu_Status)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_GET_EDGE_TIMESTAMP_SID, ICU_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (ICU_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_GET_EDGE_TIMESTAMP_SID, ICU_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if (FALSE == error)
+	{
+		Timestamp = Icu_EdgeTimestamp[Channel];
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Timestamp;
+}
+
+/************************************************************************************
+*  Service name      : Icu_GetVersionInfo
+*  Syntax            : void Icu_GetVersionInfo(Std_VersionInfoType* versioninfo)
+*  Mode              : User Mode (Non-Privileged Mode)
+*  Service ID[hex]   : 0x14
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : versioninfo - Pointer to where to store the version
+*                      information of this module.
+*  Return value      : None
+*  Description       : Service to get the version information of this module
+ ************************************************************************************/
+#if (ICU_VERSION_INFO_API == STD_ON)
+void Icu_GetVersionInfo(Std_VersionInfoType* versioninfo)
+{
+	#if (ICU_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(ICU_MODULE_ID, ICU_INSTANCE_ID, ICU_GET_VERSION_INFO_SID, ICU_E_PARAM_POINTER);
+	}
+	else
+	#endif /* (ICU_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)ICU_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)ICU_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)ICU_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)ICU_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)ICU_SW_PATCH_VERSION;
+	}
+}
+#endif
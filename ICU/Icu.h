@@ -0,0 +1,210 @@
+/******************************************************************
+ * @Module   	: Icu
+ * @Title 	 	: ICU Module Header File
+ * @Filename 	: Icu.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: Signal edge detection/notification on the GPIO pins using the GPIO
+ *                port interrupts, every detected edge is timestamped with the DWT
+ *                cycle counter.
+ ********************************************************************/
+
+#ifndef ICU_H
+#define ICU_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define ICU_VENDOR_ID				 (1000U)
+
+/* Icu Module Id */
+#define ICU_MODULE_ID				 (122U)
+
+/* Icu Instance Id */
+#define ICU_INSTANCE_ID				 (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define ICU_SW_MAJOR_VERSION		 (1U)
+#define ICU_SW_MINOR_VERSION		 (0U)
+#define ICU_SW_PATCH_VERSION		 (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define ICU_AR_RELEASE_MAJOR_VERSION (4U)
+#define ICU_AR_RELEASE_MINOR_VERSION (0U)
+#define ICU_AR_RELEASE_PATCH_VERSION (3U)
+
+/*
+ * Macros for Icu Status
+ */
+#define ICU_INITIALIZED				 (1U)
+#define ICU_NOT_INITIALIZED			 (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Icu Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Icu Pre-Compile Configuration Header file */
+#include "Icu_Cfg.h"
+
+/* AUTOSAR Version checking between Icu_Cfg.h and Icu.h files */
+#if ((ICU_CFG_AR_RELEASE_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION) || \
+	 (ICU_CFG_AR_RELEASE_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION) || \
+	 (ICU_CFG_AR_RELEASE_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Icu_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Icu_Cfg.h and Icu.h files */
+#if ((ICU_CFG_SW_MAJOR_VERSION != ICU_SW_MAJOR_VERSION) || \
+	 (ICU_CFG_SW_MINOR_VERSION != ICU_SW_MINOR_VERSION) || \
+	 (ICU_CFG_SW_PATCH_VERSION != ICU_SW_PATCH_VERSION))
+	#error "The SW version of Icu_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for ICU Init */
+#define ICU_INIT_SID					 (uint8)0x00
+
+/* Service ID for ICU set Activation Condition */
+#define ICU_SET_ACTIVATION_CONDITION_SID (uint8)0x04
+
+/* Service ID for ICU disable Notification */
+#define ICU_DISABLE_NOTIFICATION_SID	 (uint8)0x05
+
+/* Service ID for ICU enable Notification */
+#define ICU_ENABLE_NOTIFICATION_SID		 (uint8)0x06
+
+/* Service ID for ICU get Input State */
+#define ICU_GET_INPUT_STATE_SID			 (uint8)0x08
+
+/* Service ID for ICU GetVersionInfo */
+#define ICU_GET_VERSION_INFO_SID		 (uint8)0x14
+
+/* Service ID for ICU enable Edge Detection */
+#define ICU_ENABLE_EDGE_DETECTION_SID	 (uint8)0x16
+
+/* Service ID for ICU disable Edge Detection */
+#define ICU_DISABLE_EDGE_DETECTION_SID	 (uint8)0x17
+
+/* Service ID for ICU get Edge Timestamp (Not exist in AUTOSAR 4.0.3 ICU SWS Document) */
+#define ICU_GET_EDGE_TIMESTAMP_SID		 (uint8)0x20
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* Icu_Init API service called with NULL pointer parameter */
+#define ICU_E_PARAM_CONFIG				 (uint8)0x0A
+
+/* DET code to report Invalid Channel */
+#define ICU_E_PARAM_CHANNEL				 (uint8)0x0B
+
+/* DET code to report Invalid Activation Condition */
+#define ICU_E_PARAM_ACTIVATION			 (uint8)0x0C
+
+/* DET code to report that an API service is called without module initialization */
+#define ICU_E_UNINIT					 (uint8)0x14
+
+/* DET code to report that an API service is called with a NULL pointer parameter */
+#define ICU_E_PARAM_POINTER				 (uint8)0x19
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Icu_ChannelType used by the ICU APIs */
+typedef uint8 Icu_ChannelType;
+
+/* Type definition for Icu_TimestampType, the DWT cycle count at the detected edge */
+typedef uint32 Icu_TimestampType;
+
+/* Enumeration for Icu_ActivationType used by the ICU APIs */
+typedef enum
+{
+	ICU_RISING_EDGE,
+	ICU_FALLING_EDGE,
+	ICU_BOTH_EDGES
+} Icu_ActivationType;
+
+/* Enumeration for Icu_InputStateType used by the ICU APIs */
+typedef enum
+{
+	ICU_IDLE,
+	ICU_ACTIVE
+} Icu_InputStateType;
+
+/* Type definition for the edge notification, the channel is passed so one function can serve many channels */
+typedef void (*Icu_NotifyFunctionType)(Icu_ChannelType Channel);
+
+typedef struct
+{
+	/* Member contains the ID of the Port that this channel belongs to */
+	uint8 Port_Num;
+	/* Member contains the ID of the Pin */
+	uint8 Pin_Num;
+	/* Member contains the edge(s) detected after initialization */
+	Icu_ActivationType Default_Start_Edge;
+	/* Member contains the function called on every detected edge (NULL_PTR for none) */
+	Icu_NotifyFunctionType Notification;
+} Icu_ConfigChannel;
+
+/* Data Structure required for initializing the Icu Driver */
+typedef struct Icu_ConfigType
+{
+	Icu_ConfigChannel Channels[ICU_CONFIGURED_CHANNELS];
+} Icu_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for ICU Initialization API */
+void Icu_Init(const Icu_ConfigType* ConfigPtr);
+
+/* Function for ICU set Activation Condition API */
+void Icu_SetActivationCondition(Icu_ChannelType Channel, Icu_ActivationType Activation);
+
+/* Function for ICU disable Notification API */
+void Icu_DisableNotification(Icu_ChannelType Channel);
+
+/* Function for ICU enable Notification API */
+void Icu_EnableNotification(Icu_ChannelType Channel);
+
+/* Function for ICU get Input State API */
+Icu_InputStateType Icu_GetInputState(Icu_ChannelType Channel);
+
+/* Function for ICU enable Edge Detection API */
+void Icu_EnableEdgeDetection(Icu_ChannelType Channel);
+
+/* Function for ICU disable Edge Detection API */
+void Icu_DisableEdgeDetection(Icu_ChannelType Channel);
+
+/* Function for ICU get Edge Timestamp API */
+Icu_TimestampType Icu_GetEdgeTimestamp(Icu_ChannelType Channel);
+
+#if (ICU_VERSION_INFO_API == STD_ON)
+/* Function for ICU Get Version Info API */
+void Icu_GetVersionInfo(Std_VersionInfoType* versioninfo);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Icu and other modules */
+extern const Icu_ConfigType Icu_Configuration;
+
+#endif /* ICU_H */
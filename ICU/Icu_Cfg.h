@@ -0,0 +1,56 @@
+/******************************************************************
+ * @Module   	: Icu
+ * @Title 	 	: ICU Pre-Compile Configuration Header File 
+ * @Filename 	: Icu_Cfg.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: 
+ ********************************************************************/
+
+#ifndef ICU_CFG_H
+#define ICU_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define ICU_CFG_SW_MAJOR_VERSION		 (1U)
+#define ICU_CFG_SW_MINOR_VERSION		 (0U)
+#define ICU_CFG_SW_PATCH_VERSION		 (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define ICU_CFG_AR_RELEASE_MAJOR_VERSION (4U)
+#define ICU_CFG_AR_RELEASE_MINOR_VERSION (0U)
+#define ICU_CFG_AR_RELEASE_PATCH_VERSION (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define ICU_DEV_ERROR_DETECT			 (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define ICU_VERSION_INFO_API			 (STD_ON)
+
+/* Priority of the GPIO port interrupts used by the Icu channels (0 - 7) */
+#define ICU_INTERRUPT_PRIORITY			 (2U)
+
+/* Number of the configured Icu Channels */
+#define ICU_CONFIGURED_CHANNELS			 (2U)
+
+/* Channel Index in the array of structures in Icu_PBcfg.c */
+#define IcuConf_SW1_CHANNEL_ID_INDEX	 (uint8)0
+#define IcuConf_SW2_CHANNEL_ID_INDEX	 (uint8)1
+
+/* ICU Configured Port ID's  */
+#define IcuConf_SW1_PORT_NUM			 (uint8)5 /* PORTF */
+#define IcuConf_SW2_PORT_NUM			 (uint8)5 /* PORTF */
+
+/* ICU Configured Pin Numbers */
+#define IcuConf_SW1_PIN_NUM				 (uint8)4 /* Pin 4 in PORTF */
+#define IcuConf_SW2_PIN_NUM				 (uint8)0 /* Pin 0 in PORTF */
+
+/* ICU Configured default edges, the switches are active low (pull-up) */
+#define IcuConf_SW1_DEFAULT_START_EDGE	 (Icu_ActivationType) ICU_FALLING_EDGE
+#define IcuConf_SW2_DEFAULT_START_EDGE	 (Icu_ActivationType) ICU_FALLING_EDGE
+
+#endif /* ICU_CFG_H */
@@ -0,0 +1,72 @@
+/******************************************************************
+ * @Module   	: Icu
+ * @Title 	 	: ICU Post Build Configuration Source file
+ * @Filename 	: Icu_PBcfg.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: 
+ ********************************************************************/
+
+#include "Icu.h"
+#include "Button.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define ICU_PBCFG_SW_MAJOR_VERSION		   (1U)
+#define ICU_PBCFG_SW_MINOR_VERSION		   (0U)
+#define ICU_PBCFG_SW_PATCH_VERSION		   (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define ICU_PBCFG_AR_RELEASE_MAJOR_VERSION (4U)
+#define ICU_PBCFG_AR_RELEASE_MINOR_VERSION (0U)
+#define ICU_PBCFG_AR_RELEASE_PATCH_VERSION (3U)
+
+/* AUTOSAR Version checking between Icu_PBcfg.c and Icu.h files */
+#if ((ICU_PBCFG_AR_RELEASE_MAJOR_VERSION != ICU_AR_RELEASE_MAJOR_VERSION) || \
+	 (ICU_PBCFG_AR_RELEASE_MINOR_VERSION != ICU_AR_RELEASE_MINOR_VERSION) || \
+	 (ICU_PBCFG_AR_RELEASE_PATCH_VERSION != ICU_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Icu_PBcfg.c and Icu.h files */
+#if ((ICU_PBCFG_SW_MAJOR_VERSION != ICU_SW_MAJOR_VERSION) || \
+	 (ICU_PBCFG_SW_MINOR_VERSION != ICU_SW_MINOR_VERSION) || \
+	 (ICU_PBCFG_SW_PATCH_VERSION != ICU_SW_PATCH_VERSION))
+	#error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* The switches raise the edge interrupts of the Button module in edge trigger mode */
+#if (BUTTON_EDGE_TRIGGER == STD_ON)
+	#define ICU_SW_NOTIFICATION BUTTON_edgeNotification
+#else
+	#define ICU_SW_NOTIFICATION NULL_PTR
+#endif
+
+/* PB structure used with Icu_Init API */
+const Icu_ConfigType Icu_Configuration = {
+
+	.Channels =
+		{
+
+			[IcuConf_SW1_CHANNEL_ID_INDEX] =
+				{
+					.Port_Num = IcuConf_SW1_PORT_NUM,
+					.Pin_Num = IcuConf_SW1_PIN_NUM,
+					.Default_Start_Edge = IcuConf_SW1_DEFAULT_START_EDGE,
+					.Notification = ICU_SW_NOTIFICATION,
+				},
+			[IcuConf_SW2_CHANNEL_ID_INDEX] =
+				{
+					.Port_Num = IcuConf_SW2_PORT_NUM,
+					.Pin_Num = IcuConf_SW2_PIN_NUM,
+					.Default_Start_Edge = IcuConf_SW2_DEFAULT_START_EDGE,
+					.Notification = ICU_SW_NOTIFICATION,
+				}
+
+		}
+
+};
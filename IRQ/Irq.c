@@ -0,0 +1,473 @@
+/******************************************************************
+ * @Module   	: Irq
+ * @Title 	 	: Interrupt Vector Table and NVIC Source file
+ * @Filename 	: Irq.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	:
+ ********************************************************************/
+
+#include "Irq.h"
+#include "Peripheral_Regs.h"
+#include "Common_Macros.h"
+
+#if (IRQ_INSTRUMENTATION_API == STD_ON)
+	#include "Dwt.h"
+#endif
+
+/* Vector number of an interrupt or system exception */
+#define IRQ_VECTOR(IRQ)	  ((uint16)((IRQ) + 16))
+
+/* Vector table in the flash (cstartup_M.c), used until Irq_Init. Its entries are the initial SP and
+ * the handler addresses, read here as words */
+extern const uint32 __vector_table[IRQ_NUMBER_OF_VECTORS];
+
+/* Active vector table once Irq_Init has run */
+DATA_ALIGNMENT(IRQ_VECTOR_TABLE_ALIGN)
+STATIC volatile uint32 Irq_VectorTable[IRQ_NUMBER_OF_VECTORS];
+
+STATIC boolean Irq_Relocated = FALSE;
+
+#if (IRQ_INSTRUMENTATION_API == STD_ON)
+	#define IRQ_NO_SLOT (0xFFU)
+
+/* A measured handler: the vector enters Irq_MeasuredHandler, which calls Handler */
+typedef struct
+{
+	Irq_HandlerType	   Handler;
+	volatile uint32	   Trigger_Cycles; /* Irq_SetPending time, 0 when the trigger is not known */
+	Irq_StatisticsType Statistics;
+} Irq_SlotType;
+
+STATIC Irq_SlotType Irq_Slots[IRQ_INSTRUMENTED_HANDLERS];
+STATIC uint8		Irq_SlotCount = 0U;
+
+/* Slot of every vector, IRQ_NO_SLOT when its handler is not measured */
+STATIC uint8 Irq_VectorSlot[IRQ_NUMBER_OF_VECTORS];
+#endif
+
+/************************************************************************************
+* Function Name		: Irq_IsInstallable
+* Description		: Returns whether Irq is an interrupt of the device or a system exception
+*					  with a configurable priority (not the reset, NMI, hard fault or reserved ones).
+************************************************************************************/
+STATIC boolean Irq_IsInstallable(Irq_NumberType Irq)
+{
+	boolean Installable = FALSE;
+
+	if (Irq >= 0)
+	{
+		Installable = (Irq < (Irq_NumberType)IRQ_NUMBER_OF_IRQS) ? TRUE : FALSE;
+	}
+	else if (((Irq >= IRQ_MEMMANAGE) && (Irq <= IRQ_USAGEFAULT)) || (IRQ_SVCALL == Irq) ||
+			 (IRQ_DEBUGMON == Irq) || (IRQ_PENDSV == Irq) || (IRQ_SYSTICK == Irq))
+	{
+		Installable = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Installable;
+}
+
+/* The NVIC registers only exist for the interrupts of the device */
+#define IRQ_IS_DEVICE_IRQ(IRQ) (((IRQ) >= 0) && ((IRQ) < (Irq_NumberType)IRQ_NUMBER_OF_IRQS))
+
+#if (IRQ_INSTRUMENTATION_API == STD_ON)
+/************************************************************************************
+* Function Name		: Irq_Record
+* Description		: Adds one latency to the measurements of a slot.
+************************************************************************************/
+STATIC void Irq_Record(Irq_SlotType* Slot, uint32 Cycles)
+{
+	Slot->Statistics.Last_Latency = Cycles;
+	Slot->Statistics.Latency_Count++;
+
+	if (Cycles > Slot->Statistics.Max_Latency)
+	{
+		Slot->Statistics.Max_Latency = Cycles;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Function Name		: Irq_MeasuredHandler
+* Description		: Vector of every measured handler. The active vector is read from ICSR, a
+*					  handler is never preempted by itself, so the slot has a single writer.
+************************************************************************************/
+STATIC void Irq_MeasuredHandler(void)
+{
+	uint32		  Entry = IRQ_GET_CYCLES();
+	Irq_SlotType* Slot = &Irq_Slots[Irq_VectorSlot[SCB_ICSR & SCB_ICSR_VECTACTIVE]];
+	uint32		  Trigger = Slot->Trigger_Cycles;
+
+	if (0U != Trigger)
+	{
+		Slot->Trigger_Cycles = 0U;
+		Irq_Record(Slot, Entry - Trigger);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	Slot->Handler();
+
+	Slot->Statistics.Last_Duration = IRQ_GET_CYCLES() - Entry;
+	Slot->Statistics.Count++;
+
+	if (Slot->Statistics.Last_Duration > Slot->Statistics.Max_Duration)
+	{
+		Slot->Statistics.Max_Duration = Slot->Statistics.Last_Duration;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Function Name		: Irq_Measure
+* Description		: Returns the vector of a handler: Irq_MeasuredHandler when a slot is free
+*					  or already used by the vector, the handler itself otherwise.
+************************************************************************************/
+STATIC Irq_HandlerType Irq_Measure(uint16 Vector, Irq_HandlerType Handler)
+{
+	Irq_HandlerType VectorHandler = Handler;
+	uint8			Slot = Irq_VectorSlot[Vector];
+
+	if ((IRQ_NO_SLOT == Slot) && (Irq_SlotCount < IRQ_INSTRUMENTED_HANDLERS))
+	{
+		Slot = Irq_SlotCount;
+		Irq_SlotCount++;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if (IRQ_NO_SLOT != Slot)
+	{
+		Irq_Slots[Slot] = (Irq_SlotType){.Handler = Handler};
+		Irq_VectorSlot[Vector] = Slot;
+		VectorHandler = Irq_MeasuredHandler;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return VectorHandler;
+}
+#endif
+
+/*********************************************************************************************/
+void Irq_Init(void)
+{
+	/* Every vector is copied, Default_Handler included, the interrupts without a driver never fetch 0 */
+	for (uint16 Vector = 0U; Vector < IRQ_NUMBER_OF_VECTORS; Vector++)
+	{
+		Irq_VectorTable[Vector] = __vector_table[Vector];
+#if (IRQ_INSTRUMENTATION_API == STD_ON)
+		Irq_VectorSlot[Vector] = IRQ_NO_SLOT;
+#endif
+	}
+
+	/* The table must be complete before the core fetches a vector from it */
+	DATA_SYNC_BARRIER();
+	SCB_VTOR = (uint32)Irq_VectorTable;
+	DATA_SYNC_BARRIER();
+	INSTRUCTION_SYNC_BARRIER();
+
+	Irq_Relocated = TRUE;
+
+	(void)Irq_SetPriorityGrouping(IRQ_PREEMPTION_BITS);
+
+#if (IRQ_INSTRUMENTATION_API == STD_ON)
+	DWT_CYCLE_COUNTER_ENABLE();
+#endif
+}
+
+/************************************************************************************
+* Function Name		: Irq_Install
+* Description		: The vector is written before the priority and the enable, so that the
+*					  first interrupt already enters the new handler. A system exception is
+*					  only given its priority, it is enabled by its own driver (e.g. SysTick).
+*					  Before Irq_Init only the handler already in the flash table is accepted.
+************************************************************************************/
+Std_ReturnType Irq_Install(Irq_NumberType Irq, Irq_HandlerType Handler, uint8 Priority)
+{
+	Std_ReturnType Status = E_NOT_OK;
+
+	if ((NULL_PTR != Handler) && (Priority <= IRQ_LOWEST_PRIORITY) && (TRUE == Irq_IsInstallable(Irq)))
+	{
+		if (TRUE == Irq_Relocated)
+		{
+#if (IRQ_INSTRUMENTATION_API == STD_ON)
+			Handler = Irq_Measure(IRQ_VECTOR(Irq), Handler);
+#endif
+			Irq_VectorTable[IRQ_VECTOR(Irq)] = (uint32)Handler;
+			DATA_SYNC_BARRIER();
+			Status = E_OK;
+		}
+		else if (__vector_table[IRQ_VECTOR(Irq)] == (uint32)Handler)
+		{
+			Status = E_OK;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if (E_OK == Status)
+	{
+		(void)Irq_SetPriority(Irq, Priority);
+
+		if (Irq >= 0)
+		{
+			(void)Irq_Enable(Irq);
+		}
+		else
+		{
+			/* No Action Required ... enabled by the driver of the exception */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Irq_Enable(Irq_NumberType Irq)
+{
+	Std_ReturnType Status = E_NOT_OK;
+
+	if (IRQ_IS_DEVICE_IRQ(Irq))
+	{
+		NVIC_EN_REG(Irq) = BIT((uint32)Irq & 0x1FU);
+		Status = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+/************************************************************************************
+* Function Name		: Irq_Disable
+* Description		: The barriers make sure that the interrupt can not be taken any more after
+*					  the return, even if it was already pending.
+************************************************************************************/
+Std_ReturnType Irq_Disable(Irq_NumberType Irq)
+{
+	Std_ReturnType Status = E_NOT_OK;
+
+	if (IRQ_IS_DEVICE_IRQ(Irq))
+	{
+		NVIC_DIS_REG(Irq) = BIT((uint32)Irq & 0x1FU);
+		DATA_SYNC_BARRIER();
+		INSTRUCTION_SYNC_BARRIER();
+		Status = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Irq_SetPending(Irq_NumberType Irq)
+{
+	Std_ReturnType Status = E_NOT_OK;
+
+	if (IRQ_IS_DEVICE_IRQ(Irq))
+	{
+#if (IRQ_INSTRUMENTATION_API == STD_ON)
+		uint8 Slot = Irq_VectorSlot[IRQ_VECTOR(Irq)];
+
+		/* 0 marks an unknown trigger, a counter that reads 0 is one cycle late */
+		if ((TRUE == Irq_Relocated) && (IRQ_NO_SLOT != Slot))
+		{
+			uint32 Trigger = IRQ_GET_CYCLES();
+			Irq_Slots[Slot].Trigger_Cycles = (0U != Trigger) ? Trigger : 1U;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+#endif
+		NVIC_PEND_REG(Irq) = BIT((uint32)Irq & 0x1FU);
+		Status = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Irq_ClearPending(Irq_NumberType Irq)
+{
+	Std_ReturnType Status = E_NOT_OK;
+
+	if (IRQ_IS_DEVICE_IRQ(Irq))
+	{
+		NVIC_UNPEND_REG(Irq) = BIT((uint32)Irq & 0x1FU);
+		Status = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Irq_SetPriority(Irq_NumberType Irq, uint8 Priority)
+{
+	Std_ReturnType Status = E_NOT_OK;
+
+	if ((Priority <= IRQ_LOWEST_PRIORITY) && (TRUE == Irq_IsInstallable(Irq)))
+	{
+		if (Irq >= 0)
+		{
+			NVIC_PRI_BYTE(Irq) = (uint8)(Priority << NVIC_PRI_SHIFT);
+		}
+		else
+		{
+			SCB_SHP_BYTE(IRQ_VECTOR(Irq)) = (uint8)(Priority << NVIC_PRI_SHIFT);
+		}
+
+		Status = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+/*********************************************************************************************/
+uint8 Irq_GetPriority(Irq_NumberType Irq)
+{
+	uint8 Priority = IRQ_INVALID_PRIORITY;
+
+	if (Irq >= 0)
+	{
+		Priority = (TRUE == Irq_IsInstallable(Irq)) ? (uint8)(NVIC_PRI_BYTE(Irq) >> NVIC_PRI_SHIFT)
+													 : IRQ_INVALID_PRIORITY;
+	}
+	else if (TRUE == Irq_IsInstallable(Irq))
+	{
+		Priority = (uint8)(SCB_SHP_BYTE(IRQ_VECTOR(Irq)) >> NVIC_PRI_SHIFT);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Priority;
+}
+
+/************************************************************************************
+* Function Name		: Irq_SetPriorityGrouping
+* Description		: PRIGROUP n gives the priority bits [7:n+1] to the preemption level, with
+*					  the bits [7:5] implemented PRIGROUP is 7 - PreemptionBits. The key is
+*					  written with every AIRCR write, the other AIRCR bits are left at 0.
+************************************************************************************/
+Std_ReturnType Irq_SetPriorityGrouping(uint8 PreemptionBits)
+{
+	Std_ReturnType Status = E_NOT_OK;
+
+	if (PreemptionBits <= (8U - NVIC_PRI_SHIFT))
+	{
+		SCB_AIRCR = SCB_AIRCR_VECTKEY | ((uint32)(7U - PreemptionBits) << SCB_AIRCR_PRIGROUP_SHIFT);
+		DATA_SYNC_BARRIER();
+		Status = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+#if (IRQ_INSTRUMENTATION_API == STD_ON)
+/*********************************************************************************************/
+void Irq_ReportLatency(Irq_NumberType Irq, uint32 Cycles)
+{
+	if ((TRUE == Irq_IsInstallable(Irq)) && (TRUE == Irq_Relocated) &&
+		(IRQ_NO_SLOT != Irq_VectorSlot[IRQ_VECTOR(Irq)]))
+	{
+		Irq_Record(&Irq_Slots[Irq_VectorSlot[IRQ_VECTOR(Irq)]], Cycles);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Function Name		: Irq_GetStatistics
+* Description		: The measurements are copied with the interrupts masked, so that they all
+*					  come from the same entries of the handler.
+************************************************************************************/
+Std_ReturnType Irq_GetStatistics(Irq_NumberType Irq, Irq_StatisticsType* Statistics)
+{
+	Std_ReturnType Status = E_NOT_OK;
+
+	if ((NULL_PTR != Statistics) && (TRUE == Irq_IsInstallable(Irq)) && (TRUE == Irq_Relocated) &&
+		(IRQ_NO_SLOT != Irq_VectorSlot[IRQ_VECTOR(Irq)]))
+	{
+		uint32 State = INTERRUPT_STATE_SAVE();
+
+		INTERRUPTS_DISABLE();
+		*Statistics = Irq_Slots[Irq_VectorSlot[IRQ_VECTOR(Irq)]].Statistics;
+		INTERRUPT_STATE_RESTORE(State);
+
+		Status = E_OK;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	return Status;
+}
+
+/*********************************************************************************************/
+void Irq_ResetStatistics(void)
+{
+	for (uint8 Slot = 0U; Slot < Irq_SlotCount; Slot++)
+	{
+		uint32 State = INTERRUPT_STATE_SAVE();
+
+		INTERRUPTS_DISABLE();
+		Irq_Slots[Slot].Statistics = (Irq_StatisticsType){0U};
+		INTERRUPT_STATE_RESTORE(State);
+	}
+}
+#endif
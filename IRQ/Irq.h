@@ -0,0 +1,110 @@
+/******************************************************************
+ * @Module   	: Irq
+ * @Title 	 	: Interrupt Vector Table and NVIC Header file
+ * @Filename 	: Irq.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	: Irq_Init copies the vector table of cstartup_M.c to the SRAM and points VTOR to
+ *                the copy. A driver then installs its own handler with Irq_Install, the exception
+ *                enters it directly without a call back pointer in between. The other functions
+ *                manage the NVIC: enable, pending state, priority and priority grouping.
+ ********************************************************************/
+
+#ifndef IRQ_H
+#define IRQ_H
+
+#include "Std_Types.h"
+#include "Irq_Cfg.h"
+
+/* Vectors of the TM4C123GH6PM: the initial SP, 15 system exceptions and 139 interrupts */
+#define IRQ_NUMBER_OF_VECTORS  (155U)
+#define IRQ_NUMBER_OF_IRQS	   (IRQ_NUMBER_OF_VECTORS - 16U)
+
+/* The VTOR address must be aligned to the table size rounded up to a power of two (256 words) */
+#define IRQ_VECTOR_TABLE_ALIGN (1024U)
+
+#if ((IRQ_VECTOR_TABLE_ALIGN < (IRQ_NUMBER_OF_VECTORS * 4U)) || \
+	 ((IRQ_VECTOR_TABLE_ALIGN & (IRQ_VECTOR_TABLE_ALIGN - 1U)) != 0U))
+	#error "IRQ_VECTOR_TABLE_ALIGN must be a power of two covering the IRQ_NUMBER_OF_VECTORS words"
+#endif
+
+/* Priorities are 3 bits, 0 is the highest */
+#define IRQ_LOWEST_PRIORITY	   (7U)
+#define IRQ_INVALID_PRIORITY   (0xFFU) /* Irq_GetPriority of an invalid interrupt */
+
+/* Interrupt number as in the NVIC, the system exceptions are negative (vector number - 16) */
+typedef sint16 Irq_NumberType;
+
+#define IRQ_MEMMANAGE		   (Irq_NumberType)(-12)
+#define IRQ_BUSFAULT		   (Irq_NumberType)(-11)
+#define IRQ_USAGEFAULT		   (Irq_NumberType)(-10)
+#define IRQ_SVCALL			   (Irq_NumberType)(-5)
+#define IRQ_DEBUGMON		   (Irq_NumberType)(-4)
+#define IRQ_PENDSV			   (Irq_NumberType)(-2)
+#define IRQ_SYSTICK			   (Irq_NumberType)(-1)
+
+/* Handler of an exception or interrupt */
+typedef void (*Irq_HandlerType)(void);
+
+#if (IRQ_INSTRUMENTATION_API == STD_ON)
+/* Measurements of one handler in DWT cycles. The latency is only known for the interrupts pended by
+ * Irq_SetPending or reported by their driver with Irq_ReportLatency */
+typedef struct
+{
+	uint32 Count;			/* entries of the handler */
+	uint32 Last_Latency;	/* trigger to first instruction of the handler */
+	uint32 Max_Latency;
+	uint32 Latency_Count;	/* entries with a known latency */
+	uint32 Last_Duration;	/* cycles spent in the handler, including the interrupts preempting it */
+	uint32 Max_Duration;
+} Irq_StatisticsType;
+#endif
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function to copy the vector table to the SRAM and make it the active one, called with the
+ * interrupts disabled before the drivers install their handlers */
+void Irq_Init(void);
+
+/* Function to install the handler of an interrupt (Irq >= 0, also enabled in the NVIC) or of a
+ * configurable system exception (IRQ_xxx) with its priority (0 highest to 7) */
+Std_ReturnType Irq_Install(Irq_NumberType Irq, Irq_HandlerType Handler, uint8 Priority);
+
+/* Function to enable an interrupt in the NVIC */
+Std_ReturnType Irq_Enable(Irq_NumberType Irq);
+
+/* Function to disable an interrupt in the NVIC, it can not be entered any more when it returns */
+Std_ReturnType Irq_Disable(Irq_NumberType Irq);
+
+/* Function to pend an interrupt from the software */
+Std_ReturnType Irq_SetPending(Irq_NumberType Irq);
+
+/* Function to clear the pending state of an interrupt */
+Std_ReturnType Irq_ClearPending(Irq_NumberType Irq);
+
+/* Function to set the priority (0 highest to 7) of an interrupt or a configurable system exception */
+Std_ReturnType Irq_SetPriority(Irq_NumberType Irq, uint8 Priority);
+
+/* Function to get the priority of an interrupt or a configurable system exception (IRQ_INVALID_PRIORITY
+ * for any other number) */
+uint8 Irq_GetPriority(Irq_NumberType Irq);
+
+/* Function to split the 3 priority bits in PreemptionBits bits of preemption level (0 to 3), the
+ * remaining bits only order the pending interrupts of the same level */
+Std_ReturnType Irq_SetPriorityGrouping(uint8 PreemptionBits);
+
+#if (IRQ_INSTRUMENTATION_API == STD_ON)
+/* Function for a driver that knows when its interrupt was triggered to record the latency */
+void Irq_ReportLatency(Irq_NumberType Irq, uint32 Cycles);
+
+/* Function to read the measurements of a handler installed with the instrumentation */
+Std_ReturnType Irq_GetStatistics(Irq_NumberType Irq, Irq_StatisticsType* Statistics);
+
+/* Function to restart the measurements of all the handlers */
+void Irq_ResetStatistics(void);
+#endif
+
+#endif /* IRQ_H */
@@ -0,0 +1,30 @@
+/******************************************************************
+ * @Module   	: Irq
+ * @Title 	 	: Interrupt Vector Table Configuration Header
+ * @Filename 	: Irq_Cfg.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	:
+ ********************************************************************/
+
+#ifndef IRQ_CFG_H
+#define IRQ_CFG_H
+
+/* Priority bits giving the preemption level (0 to 3), set by Irq_Init. The remaining bits only order
+ * the pending interrupts of the same level */
+#define IRQ_PREEMPTION_BITS			 (3U)
+
+/* Pre-compile option to measure the latency and the duration of the installed handlers. Every
+ * handler is then entered through a common wrapper, which costs about 30 cycles per interrupt */
+#define IRQ_INSTRUMENTATION_API		 (STD_OFF)
+
+/* Number of handlers that can be measured, the next ones are installed without the wrapper */
+#define IRQ_INSTRUMENTED_HANDLERS	 (8U)
+
+/* Cycle counter read at the entry and at the exit of an instrumented handler */
+#ifndef IRQ_GET_CYCLES
+	#define IRQ_GET_CYCLES() DWT_GET_CYCLES()
+#endif
+
+#endif /* IRQ_CFG_H */
@@ -10,6 +10,8 @@
 #ifndef COMMON_MACROS /*header guard*/
 #define COMMON_MACROS
 
+#include "Std_Types.h"
+
 /* Set a bit to 1 */
 #define SET_BIT(reg, bit)			 ((reg) |= (1U << (bit)))
 
@@ -61,4 +63,78 @@
 /* Set a bit to 1 */
 #define BIT(x)						 (1U << (x))
 
+/* Compile-time assertion usable as an expression (value void): COND must be a constant expression
+ * and true, otherwise the bit-field width is negative or not constant and the build fails */
+#define STATIC_ASSERT_EXPR(COND)	 ((void)sizeof(struct { int static_assert_failed : (COND) ? 1 : -1; }))
+
+/************************************************************************************************
+ * Atomic variants: safe to use on state shared between tasks and ISRs without masking interrupts.
+ * The bit operations write the bit-band alias word of the bit (single store, the bus does the
+ * read-modify-write), so they are only valid for objects in the first 1 MB of the SRAM
+ * (0x20000000) and of the peripheral region (0x40000000), and must not be used on write-1-to-clear
+ * registers. The mask operations retry an LDREX/STREX pair and need a 32-bit aligned word.
+ ************************************************************************************************/
+
+/* Address of the bit-band alias word of a bit (region base + 32 MB + byte offset * 32 + bit * 4) */
+#define BITBAND_ALIAS(addr, bit)                                         \
+	((volatile uint32*)((((uint32)(addr)) & 0xF0000000U) + 0x02000000U + \
+						((((uint32)(addr)) & 0x000FFFFFU) << 5) + (((uint32)(bit)) << 2)))
+
+#if defined(__ICCARM__)
+
+	/* Set a bit to 1 */
+	#define ATOMIC_SET_BIT(reg, bit)		 (*BITBAND_ALIAS(&(reg), bit) = 1U)
+
+	/* Clear a bit to 0 */
+	#define ATOMIC_CLEAR_BIT(reg, bit)		 (*BITBAND_ALIAS(&(reg), bit) = 0U)
+
+	/* clear a specific bit and set it with a value 0 or 1 */
+	#define ATOMIC_WRITE_BIT(reg, bit, value) (*BITBAND_ALIAS(&(reg), bit) = (uint32)(value))
+
+	/* Read a bit (returns 1 if 1, 0 if 0) */
+	#define ATOMIC_READ_BIT(reg, bit)		 (*BITBAND_ALIAS(&(reg), bit))
+
+#else /* No bit-band region on other targets, the plain macros are used */
+
+	#define ATOMIC_SET_BIT(reg, bit)		 SET_BIT(reg, bit)
+	#define ATOMIC_CLEAR_BIT(reg, bit)		 CLEAR_BIT(reg, bit)
+	#define ATOMIC_WRITE_BIT(reg, bit, value) WRITE_BIT(reg, bit, value)
+	#define ATOMIC_READ_BIT(reg, bit)		 READ_BIT(reg, bit)
+
+#endif
+
+/* Apply OP with OPERAND to a 32-bit word, retried until no other access hit the word in between */
+#define ATOMIC_MASK_OPERATION(reg, OP, operand)                 \
+	do                                                          \
+	{                                                           \
+		uint32 atomic_value_;                                   \
+		do                                                      \
+		{                                                       \
+			atomic_value_ = LOAD_EXCLUSIVE(&(reg)) OP(operand); \
+		} while (0U != STORE_EXCLUSIVE(atomic_value_, &(reg))); \
+	} while (0)
+
+/* Add 1 to a 32-bit counter, retried until no other access hit the word in between (wraps at 2^32) */
+#define ATOMIC_INCREMENT(reg)                                   \
+	do                                                          \
+	{                                                           \
+		uint32 atomic_value_;                                   \
+		do                                                      \
+		{                                                       \
+			atomic_value_ = LOAD_EXCLUSIVE(&(reg)) + 1U;        \
+		} while (0U != STORE_EXCLUSIVE(atomic_value_, &(reg))); \
+	} while (0)
+
+/* Set multiple bits based on mask */
+#define ATOMIC_SET_MASK(reg, mask)		 ATOMIC_MASK_OPERATION(reg, |, (uint32)(mask))
+
+/* Clear multiple bits based on mask */
+#define ATOMIC_CLEAR_MASK(reg, mask)	 ATOMIC_MASK_OPERATION(reg, &, ~(uint32)(mask))
+
+/* Toggle multiple bits based on mask */
+#define ATOMIC_TOGGLE_MASK(reg, mask)	 ATOMIC_MASK_OPERATION(reg, ^, (uint32)(mask))
+
+/* Toggle a bit (a bit-band read then write would not be atomic) */
+#define ATOMIC_TOGGLE_BIT(reg, bit)		 ATOMIC_TOGGLE_MASK(reg, BIT(bit))
+
 #endif /* COMMON_MACROS */
\ No newline at end of file
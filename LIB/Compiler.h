@@ -48,4 +48,52 @@
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC		 static
 
+/* This is used to define the abstraction of the fast memory sections. A FUNC_RAM function runs from the
+   SRAM and a CONST_FAST table is read from the SRAM, so neither stalls on the flash wait states. The IAR
+   startup (__iar_data_init3, called before main) copies both from the flash like the initialized data:
+   __ramfunc code goes to .textrw and a CONST_FAST table is initialized data, it is only written by the
+   copy. MemMap.h switches a whole block of functions with XXX_START_SEC_CODE_FAST */
+#if defined(__ICCARM__)
+	#define FUNC_RAM   __ramfunc
+	#define CONST_FAST
+#else
+	#define FUNC_RAM
+	#define CONST_FAST const
+#endif
+
+/* This is used to define the abstraction of the alignment of a variable, placed before its definition.
+   IAR takes it with #pragma data_alignment, built by _Pragma from the expanded value, so the alignment
+   can be given by a configuration macro */
+#if defined(__ICCARM__)
+	#define DATA_ALIGNMENT_PRAGMA(x) _Pragma(#x)
+	#define DATA_ALIGNMENT(n)		 DATA_ALIGNMENT_PRAGMA(data_alignment = n)
+#else
+	#define DATA_ALIGNMENT(n)		 __attribute__((aligned(n)))
+#endif
+
+/* This is used to define the abstraction of the count leading zeros instruction (CLZ), of the
+   exclusive access instructions (LDREX/STREX), of the barriers (DSB/ISB) and of the interrupt mask
+   (PRIMASK), the exclusive store returns 0 when the word was not written by anyone else since the
+   matching exclusive load */
+#if defined(__ICCARM__)
+	#include <intrinsics.h>
+	#define COUNT_LEADING_ZEROS(x)		 ((uint8)__CLZ(x))
+	#define LOAD_EXCLUSIVE(addr)		 ((uint32)__LDREX((unsigned long*)(addr)))
+	#define STORE_EXCLUSIVE(value, addr) ((uint32)__STREX((unsigned long)(value), (unsigned long*)(addr)))
+	#define DATA_SYNC_BARRIER()			 __DSB()
+	#define INSTRUCTION_SYNC_BARRIER()	 __ISB()
+	#define INTERRUPT_STATE_SAVE()		 ((uint32)__get_PRIMASK())
+	#define INTERRUPTS_DISABLE()		 __disable_interrupt()
+	#define INTERRUPT_STATE_RESTORE(s)	 __set_PRIMASK(s)
+#else
+	#define COUNT_LEADING_ZEROS(x)		 ((uint8)__builtin_clz((unsigned int)(x)))
+	#define LOAD_EXCLUSIVE(addr)		 (*((volatile uint32*)(addr)))
+	#define STORE_EXCLUSIVE(value, addr) ((*((volatile uint32*)(addr)) = (value)), 0U)
+	#define DATA_SYNC_BARRIER()			 __sync_synchronize()
+	#define INSTRUCTION_SYNC_BARRIER()	 __sync_synchronize()
+	#define INTERRUPT_STATE_SAVE()		 (0U)
+	#define INTERRUPTS_DISABLE()
+	#define INTERRUPT_STATE_RESTORE(s)	 ((void)(s))
+#endif
+
 #endif
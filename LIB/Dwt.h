@@ -0,0 +1,35 @@
+/******************************************************************
+ * @Title 	 	: DWT Cycle Counter Header File
+ * @Filename 	: Dwt.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: The DWT cycle counter runs at the core clock, it is used to timestamp
+ *                events and to measure execution time in CPU cycles
+ ********************************************************************/
+
+#ifndef DWT_H
+#define DWT_H
+
+#include "Std_Types.h"
+#include "Common_Macros.h"
+
+/* Debug Exception and Monitor Control Register */
+#define CORE_DEMCR				   (*((volatile uint32*)(0xE000EDFC)))
+#define CORE_DEMCR_TRCENA		   BIT(24) /* Trace (DWT/ITM) enable */
+
+/* DWT Control Register */
+#define DWT_CTRL				   (*((volatile uint32*)(0xE0001000)))
+#define DWT_CTRL_CYCCNTENA		   BIT(0) /* Cycle counter enable */
+
+/* DWT Cycle Count Register */
+#define DWT_CYCCNT				   (*((volatile uint32*)(0xE0001004)))
+
+/* Enable the trace block then start the free running cycle counter */
+#define DWT_CYCLE_COUNTER_ENABLE() \
+	(SET_MASK(CORE_DEMCR, CORE_DEMCR_TRCENA), SET_MASK(DWT_CTRL, DWT_CTRL_CYCCNTENA))
+
+/* Read the current value of the cycle counter (wraps every 2^32 cycles) */
+#define DWT_GET_CYCLES()		   ((uint32)DWT_CYCCNT)
+
+#endif /* DWT_H */
@@ -0,0 +1,39 @@
+/******************************************************************
+ * @Title 	 	: Memory Mapping Header File
+ * @Filename 	: MemMap.h
+ * @Description : Memory sections of the AUTOSAR memory mapping. A module header <Msn>_MemMap.h turns
+ *                its <MSN>_START_SEC_xxx / <MSN>_STOP_SEC_xxx define into the START_SEC_xxx /
+ *                STOP_SEC_xxx define handled here, the definitions between START and STOP are placed
+ *                in the section:
+ *                  #define OS_START_SEC_CODE_FAST
+ *                  #include "Os_MemMap.h"
+ *                  ... functions executed from the SRAM ...
+ *                  #define OS_STOP_SEC_CODE_FAST
+ *                  #include "Os_MemMap.h"
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	: This file is included several times on purpose, it has no include guard.
+ ********************************************************************/
+
+#define MEMMAP_ERROR
+
+/* Functions executed from the SRAM (see FUNC_RAM in Compiler.h) */
+#if defined(START_SEC_CODE_FAST)
+	#undef START_SEC_CODE_FAST
+	#undef MEMMAP_ERROR
+	#if defined(__ICCARM__)
+		#pragma default_function_attributes = __ramfunc
+	#endif
+
+#elif defined(STOP_SEC_CODE_FAST)
+	#undef STOP_SEC_CODE_FAST
+	#undef MEMMAP_ERROR
+	#if defined(__ICCARM__)
+		#pragma default_function_attributes =
+	#endif
+
+#endif
+
+#if defined(MEMMAP_ERROR)
+	#error "MemMap.h: no valid memory section defined"
+#endif
@@ -37,6 +37,13 @@
 /************************************ GPIO register offsets *****************************************/
 #define GPIO_O_DATA			(0x00000000) /* GPIO Data Offset */
 #define GPIO_O_DIR			(0x00000400) /* GPIO Direction Offset */
+#define GPIO_O_IS			(0x00000404) /* GPIO Interrupt Sense Offset */
+#define GPIO_O_IBE			(0x00000408) /* GPIO Interrupt Both Edges Offset */
+#define GPIO_O_IEV			(0x0000040C) /* GPIO Interrupt Event Offset */
+#define GPIO_O_IM			(0x00000410) /* GPIO Interrupt Mask Offset */
+#define GPIO_O_RIS			(0x00000414) /* GPIO Raw Interrupt Status Offset */
+#define GPIO_O_MIS			(0x00000418) /* GPIO Masked Interrupt Status Offset */
+#define GPIO_O_ICR			(0x0000041C) /* GPIO Interrupt Clear Offset */
 #define GPIO_O_AFSEL		(0x00000420) /* GPIO Alternate Function Select Offset */
 #define GPIO_O_PUR			(0x00000510) /* GPIO Pull-Up Select Offset */
 #define GPIO_O_PDR			(0x00000514) /* GPIO Pull-Down Select Offset */
@@ -55,24 +62,189 @@
 #define PORTD_BASE_ADDRESS	(0x40007000) /* PORTD base address */
 #define PORTE_BASE_ADDRESS	(0x40024000) /* PORTE base address */
 #define PORTF_BASE_ADDRESS	(0x40025000) /* PORTF base address */
+
+/* Register map of a GPIO port, every member is at its GPIO_O_xxx offset. Address lines [9:2] of a DATA
+ * access act as a pin mask, so DATA[MASK] only reads / changes the pins set in MASK without a
+ * read-modify-write, and DATA[GPIO_ALL_PINS] is the whole port */
+typedef struct
+{
+	uint32 DATA[256];	   /* 0x000 */
+	uint32 DIR;			   /* 0x400 */
+	uint32 IS;			   /* 0x404 */
+	uint32 IBE;			   /* 0x408 */
+	uint32 IEV;			   /* 0x40C */
+	uint32 IM;			   /* 0x410 */
+	uint32 RIS;			   /* 0x414 */
+	uint32 MIS;			   /* 0x418 */
+	uint32 ICR;			   /* 0x41C */
+	uint32 AFSEL;		   /* 0x420 */
+	uint32 Reserved0[55];  /* 0x424 */
+	uint32 DR2R;		   /* 0x500 */
+	uint32 DR4R;		   /* 0x504 */
+	uint32 DR8R;		   /* 0x508 */
+	uint32 ODR;			   /* 0x50C */
+	uint32 PUR;			   /* 0x510 */
+	uint32 PDR;			   /* 0x514 */
+	uint32 SLR;			   /* 0x518 */
+	uint32 DEN;			   /* 0x51C */
+	uint32 LOCK;		   /* 0x520 */
+	uint32 CR;			   /* 0x524 */
+	uint32 AMSEL;		   /* 0x528 */
+	uint32 PCTL;		   /* 0x52C */
+} GPIO_RegType;
+
+#define GPIO_ALL_PINS		(0xFFU) /* DATA index of the whole port */
+
+/* Registers of the GPIO port whose base address is BASE */
+#define GPIO_REGS(BASE)		((volatile GPIO_RegType*)(BASE))
+
+/* Registers of port PORT (PORTA to PORTF), every register of the port is addressed from the one base
+ * address loaded from GPIO_BASE_ADDRESS */
+#define GPIO_PORT(PORT)		GPIO_REGS(GPIO_BASE_ADDRESS[PORT])
 /*==================================================================================================*/
 
 /************************************ GPIO clock register *******************************************/
 #define RCGCGPIO			(*((volatile uint32*)(0x400FE608)))
+#define PRGPIO				(*((volatile uint32*)(0x400FEA08))) /* GPIO Peripheral Ready */
+/*==================================================================================================*/
+
+/************************************ General-Purpose Timer registers *******************************/
+#define TIMER_O_CFG			(0x00000000) /* GPTM Configuration Offset */
+#define TIMER_O_TAMR		(0x00000004) /* GPTM Timer A Mode Offset */
+#define TIMER_O_CTL			(0x0000000C) /* GPTM Control Offset */
+#define TIMER_O_IMR			(0x00000018) /* GPTM Interrupt Mask Offset */
+#define TIMER_O_RIS			(0x0000001C) /* GPTM Raw Interrupt Status Offset */
+#define TIMER_O_MIS			(0x00000020) /* GPTM Masked Interrupt Status Offset */
+#define TIMER_O_ICR			(0x00000024) /* GPTM Interrupt Clear Offset */
+#define TIMER_O_TAILR		(0x00000028) /* GPTM Timer A Interval Load Offset */
+#define TIMER_O_TAR			(0x00000048) /* GPTM Timer A Offset */
+
+#define TIMER0_BASE_ADDRESS (0x40030000) /* 16/32-bit Timer 0 base address */
+#define TIMER1_BASE_ADDRESS (0x40031000) /* 16/32-bit Timer 1 base address */
+#define TIMER2_BASE_ADDRESS (0x40032000) /* 16/32-bit Timer 2 base address */
+#define TIMER3_BASE_ADDRESS (0x40033000) /* 16/32-bit Timer 3 base address */
+
+/* Register at OFFSET of the timer whose base address is BASE */
+#define TIMER_REG(BASE, OFFSET) (*((volatile uint32*)((uint32)(BASE) + (uint32)(OFFSET))))
+
+#define RCGCTIMER			(*((volatile uint32*)(0x400FE604)))
+#define PRTIMER				(*((volatile uint32*)(0x400FEA04))) /* Timer Peripheral Ready */
 /*==================================================================================================*/
 
-/* 0x3FC for Bit Banding for the whole port (8 bits) 00000011 11111100 */
-#define PORTA_DATA_BIT_BAND 0x3FC
-
-extern volatile uint32* const GPIODATA[NUMBER_OF_PORTS];
-extern volatile uint32* const GPIODIR[NUMBER_OF_PORTS];
-extern volatile uint32* const GPIOAFSEL[NUMBER_OF_PORTS];
-extern volatile uint32* const GPIOPUR[NUMBER_OF_PORTS];
-extern volatile uint32* const GPIOPDR[NUMBER_OF_PORTS];
-extern volatile uint32* const GPIODEN[NUMBER_OF_PORTS];
-extern volatile uint32* const GPIOLOCK[NUMBER_OF_PORTS];
-extern volatile uint32* const GPIOCR[NUMBER_OF_PORTS];
-extern volatile uint32* const GPIOAMSEL[NUMBER_OF_PORTS];
-extern volatile uint32* const GPIOPCTL[NUMBER_OF_PORTS];
+/************************************ PWM registers *************************************************/
+#define PWM_O_CTL			(0x00000000) /* PWM Master Control Offset */
+#define PWM_O_SYNC			(0x00000004) /* PWM Time Base Sync Offset */
+#define PWM_O_ENABLE		(0x00000008) /* PWM Output Enable Offset */
+#define PWM_O_INVERT		(0x0000000C) /* PWM Output Inversion Offset */
+
+/* Offset of the registers of generator GEN (0 to 3) */
+#define PWM_O_GEN(GEN)		(0x00000040 + (0x00000040 * (uint32)(GEN)))
+
+#define PWM_O_GEN_CTL		(0x00000000) /* PWMn Control Offset in the generator */
+#define PWM_O_GEN_LOAD		(0x00000010) /* PWMn Load Offset in the generator */
+#define PWM_O_GEN_COUNT		(0x00000014) /* PWMn Counter Offset in the generator */
+#define PWM_O_GEN_CMPA		(0x00000018) /* PWMn Compare A Offset in the generator */
+#define PWM_O_GEN_CMPB		(0x0000001C) /* PWMn Compare B Offset in the generator */
+#define PWM_O_GEN_GENA		(0x00000020) /* PWMn Generator A Control Offset in the generator */
+#define PWM_O_GEN_GENB		(0x00000024) /* PWMn Generator B Control Offset in the generator */
+
+#define PWM0_BASE_ADDRESS (0x40028000) /* PWM Module 0 base address */
+#define PWM1_BASE_ADDRESS (0x40029000) /* PWM Module 1 base address */
+
+/* Register at OFFSET of the PWM module whose base address is BASE */
+#define PWM_REG(BASE, OFFSET) (*((volatile uint32*)((uint32)(BASE) + (uint32)(OFFSET))))
+
+#define RCGCPWM				(*((volatile uint32*)(0x400FE640)))
+#define PRPWM				(*((volatile uint32*)(0x400FEA40))) /* PWM Peripheral Ready */
+/*==================================================================================================*/
+
+/************************************ EEPROM registers **********************************************/
+#define EEPROM_BASE_ADDRESS (0x400AF000) /* EEPROM base address */
+
+#define EEPROM_EESIZE		(*((volatile uint32*)(EEPROM_BASE_ADDRESS + 0x000))) /* EEPROM Size Information */
+#define EEPROM_EEBLOCK		(*((volatile uint32*)(EEPROM_BASE_ADDRESS + 0x004))) /* EEPROM Current Block */
+#define EEPROM_EEOFFSET		(*((volatile uint32*)(EEPROM_BASE_ADDRESS + 0x008))) /* EEPROM Current Offset */
+#define EEPROM_EERDWR		(*((volatile uint32*)(EEPROM_BASE_ADDRESS + 0x010))) /* EEPROM Read-Write */
+#define EEPROM_EEDONE		(*((volatile uint32*)(EEPROM_BASE_ADDRESS + 0x018))) /* EEPROM Done Status */
+#define EEPROM_EESUPP		(*((volatile uint32*)(EEPROM_BASE_ADDRESS + 0x01C))) /* EEPROM Support Control */
+
+#define RCGCEEPROM			(*((volatile uint32*)(0x400FE658)))
+#define SREEPROM			(*((volatile uint32*)(0x400FE558))) /* EEPROM Software Reset */
+#define PREEPROM			(*((volatile uint32*)(0x400FEA58))) /* EEPROM Peripheral Ready */
+/*==================================================================================================*/
+
+/************************************ UART registers ************************************************/
+#define UART_O_DR			(0x00000000) /* UART Data Offset */
+#define UART_O_FR			(0x00000018) /* UART Flag Offset */
+#define UART_O_IBRD			(0x00000024) /* UART Integer Baud-Rate Divisor Offset */
+#define UART_O_FBRD			(0x00000028) /* UART Fractional Baud-Rate Divisor Offset */
+#define UART_O_LCRH			(0x0000002C) /* UART Line Control Offset */
+#define UART_O_CTL			(0x00000030) /* UART Control Offset */
+#define UART_O_IFLS			(0x00000034) /* UART Interrupt FIFO Level Select Offset */
+#define UART_O_IM			(0x00000038) /* UART Interrupt Mask Offset */
+#define UART_O_MIS			(0x00000040) /* UART Masked Interrupt Status Offset */
+#define UART_O_ICR			(0x00000044) /* UART Interrupt Clear Offset */
+#define UART_O_DMACTL		(0x00000048) /* UART DMA Control Offset */
+#define UART_O_CC			(0x00000FC8) /* UART Clock Configuration Offset */
+
+#define UART0_BASE_ADDRESS	(0x4000C000) /* UART 0 base address */
+
+/* Register at OFFSET of the UART whose base address is BASE */
+#define UART_REG(BASE, OFFSET) (*((volatile uint32*)((uint32)(BASE) + (uint32)(OFFSET))))
+
+#define RCGCUART			(*((volatile uint32*)(0x400FE618)))
+#define PRUART				(*((volatile uint32*)(0x400FEA18))) /* UART Peripheral Ready */
+/*==================================================================================================*/
+
+/************************************ uDMA registers ************************************************/
+#define UDMA_BASE_ADDRESS	(0x400FF000) /* uDMA base address */
+
+#define UDMA_CFG			(*((volatile uint32*)(UDMA_BASE_ADDRESS + 0x004))) /* DMA Configuration */
+#define UDMA_CTLBASE		(*((volatile uint32*)(UDMA_BASE_ADDRESS + 0x008))) /* DMA Channel Control Base */
+#define UDMA_USEBURSTCLR	(*((volatile uint32*)(UDMA_BASE_ADDRESS + 0x01C))) /* DMA Useburst Clear */
+#define UDMA_REQMASKCLR		(*((volatile uint32*)(UDMA_BASE_ADDRESS + 0x024))) /* DMA Request Mask Clear */
+#define UDMA_ENASET			(*((volatile uint32*)(UDMA_BASE_ADDRESS + 0x028))) /* DMA Enable Set */
+#define UDMA_ALTCLR			(*((volatile uint32*)(UDMA_BASE_ADDRESS + 0x034))) /* DMA Alternate Clear */
+#define UDMA_CHIS			(*((volatile uint32*)(UDMA_BASE_ADDRESS + 0x504))) /* DMA Interrupt Status */
+#define UDMA_CHMAP1			(*((volatile uint32*)(UDMA_BASE_ADDRESS + 0x514))) /* Channel 8-15 Map Select */
+
+/* Channel control structure of the control table addressed by UDMA_CTLBASE (1024-byte aligned) */
+typedef struct
+{
+	uint32 SRCENDP; /* Address of the last source byte */
+	uint32 DSTENDP; /* Address of the last destination byte */
+	uint32 CHCTL;	/* Control word */
+	uint32 Unused;
+} UDMA_ControlType;
+
+#define RCGCDMA				(*((volatile uint32*)(0x400FE60C)))
+#define PRDMA				(*((volatile uint32*)(0x400FEA0C))) /* uDMA Peripheral Ready */
+/*==================================================================================================*/
+
+/************************************ NVIC registers ************************************************/
+#define NVIC_EN0			(*((volatile uint32*)(0xE000E100)))		   /* Interrupt 0-31 Set Enable */
+/* Set Enable register of an IRQ, bit (IRQ % 32) enables it */
+#define NVIC_EN_REG(IRQ)	(*((volatile uint32*)((uint32)0xE000E100 + (4U * ((IRQ) >> 5U)))))
+/* Clear Enable, Set Pending and Clear Pending registers of an IRQ, same layout as NVIC_EN_REG */
+#define NVIC_DIS_REG(IRQ)	(*((volatile uint32*)((uint32)0xE000E180 + (4U * ((IRQ) >> 5U)))))
+#define NVIC_PEND_REG(IRQ)	(*((volatile uint32*)((uint32)0xE000E200 + (4U * ((IRQ) >> 5U)))))
+#define NVIC_UNPEND_REG(IRQ) (*((volatile uint32*)((uint32)0xE000E280 + (4U * ((IRQ) >> 5U)))))
+#define NVIC_PRI_BYTE(IRQ)	(*((volatile uint8*)((uint32)0xE000E400 + (IRQ)))) /* Byte-wide priority of an IRQ */
+#define NVIC_PRI_SHIFT		(5U)									   /* Only bits [7:5] are implemented */
+#define SCB_ICSR			(*((volatile uint32*)(0xE000ED04)))		   /* Interrupt Control and State */
+#define SCB_ICSR_VECTACTIVE (0x000001FFU)							   /* Vector of the active exception */
+#define SCB_VTOR			(*((volatile uint32*)(0xE000ED08)))		   /* Vector Table Offset */
+#define SCB_AIRCR			(*((volatile uint32*)(0xE000ED0C)))		   /* App. Int. and Reset Control */
+#define SCB_AIRCR_VECTKEY	(0x05FA0000U)							   /* Key of every AIRCR write */
+#define SCB_AIRCR_PRIGROUP_SHIFT (8U)								   /* PRIGROUP field, bits [10:8] */
+/* Byte-wide priority of system exception VECTOR (4 to 15) in SHPR1-3 */
+#define SCB_SHP_BYTE(VECTOR) (*((volatile uint8*)((uint32)0xE000ED18 + (VECTOR) - 4U)))
+/*==================================================================================================*/
+
+/* Address of the GPIODATA alias that only exposes the bits set in MASK, a store through it changes only
+ * those pins without reading the port */
+#define GPIO_DATA_MASKED(PORT, MASK) (&GPIO_PORT(PORT)->DATA[(MASK)])
+
+extern CONST_FAST uint32 GPIO_BASE_ADDRESS[NUMBER_OF_PORTS];
 
 #endif /* PORT_REGS_H */
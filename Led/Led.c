@@ -12,29 +12,432 @@
 #include "Dio.h"
 #include "Led.h"
 
+#if (LED_PWM_API == STD_ON)
+/* Brightness as a 16.16 fixed point level, so that slow fades move by less than one level per step */
+static uint32 g_Led_Level = 0;
+
+/* Running fade: level added every step, remaining steps and final brightness */
+static sint32		   g_Led_FadeStep = 0;
+static volatile uint16 g_Led_FadeSteps = 0;
+static uint8		   g_Led_Target = 0;
+
+/*
+ * Duty cycle of every brightness level, gamma 2.2 (duty = (Level / 255) ^ 2.2) so that the perceived
+ * brightness is linear with the level: the eye is far more sensitive to the low duty cycles.
+ */
+static const uint16 Led_GammaDuty[LED_MAX_BRIGHTNESS + 1U] = {
+	    0U,     0U,     1U,     2U,     4U,     6U,     9U,    12U,    16U,    21U,    26U,    33U,
+	   39U,    47U,    55U,    64U,    74U,    85U,    96U,   108U,   121U,   135U,   149U,   165U,
+	  181U,   198U,   216U,   234U,   254U,   274U,   296U,   318U,   341U,   365U,   389U,   415U,
+	  441U,   469U,   497U,   527U,   557U,   588U,   620U,   653U,   687U,   721U,   757U,   794U,
+	  831U,   870U,   909U,   950U,   991U,  1034U,  1077U,  1122U,  1167U,  1213U,  1261U,  1309U,
+	 1358U,  1409U,  1460U,  1512U,  1566U,  1620U,  1675U,  1732U,  1789U,  1847U,  1907U,  1967U,
+	 2029U,  2091U,  2155U,  2219U,  2285U,  2351U,  2419U,  2488U,  2558U,  2629U,  2701U,  2774U,
+	 2848U,  2923U,  2999U,  3076U,  3154U,  3234U,  3314U,  3396U,  3479U,  3562U,  3647U,  3733U,
+	 3820U,  3908U,  3997U,  4088U,  4179U,  4271U,  4365U,  4460U,  4555U,  4652U,  4750U,  4850U,
+	 4950U,  5051U,  5154U,  5257U,  5362U,  5468U,  5575U,  5683U,  5793U,  5903U,  6015U,  6127U,
+	 6241U,  6356U,  6472U,  6590U,  6708U,  6828U,  6948U,  7070U,  7193U,  7317U,  7443U,  7569U,
+	 7697U,  7826U,  7956U,  8087U,  8220U,  8353U,  8488U,  8624U,  8761U,  8899U,  9038U,  9179U,
+	 9321U,  9464U,  9608U,  9753U,  9900U, 10048U, 10197U, 10347U, 10498U, 10651U, 10805U, 10960U,
+	11116U, 11273U, 11432U, 11591U, 11752U, 11915U, 12078U, 12243U, 12408U, 12576U, 12744U, 12913U,
+	13084U, 13256U, 13429U, 13604U, 13779U, 13956U, 14134U, 14313U, 14494U, 14676U, 14859U, 15043U,
+	15229U, 15415U, 15603U, 15793U, 15983U, 16175U, 16368U, 16562U, 16757U, 16954U, 17152U, 17351U,
+	17552U, 17754U, 17957U, 18161U, 18366U, 18573U, 18781U, 18991U, 19201U, 19413U, 19626U, 19841U,
+	20056U, 20273U, 20491U, 20711U, 20932U, 21154U, 21377U, 21601U, 21827U, 22054U, 22283U, 22513U,
+	22744U, 22976U, 23210U, 23444U, 23681U, 23918U, 24157U, 24397U, 24638U, 24881U, 25125U, 25370U,
+	25616U, 25864U, 26113U, 26364U, 26616U, 26869U, 27123U, 27379U, 27636U, 27894U, 28153U, 28414U,
+	28677U, 28940U, 29205U, 29471U, 29739U, 30007U, 30277U, 30549U, 30822U, 31096U, 31371U, 31648U,
+	31926U, 32205U, 32486U, 32768U,
+};
+
+/* Description: Duty cycle of a 16.16 brightness, interpolated between two levels of the gamma table */
+static uint16 LED_levelDuty(uint32 Level)
+{
+	uint32 index = Level >> 16U;
+	uint32 duty = Led_GammaDuty[index];
+
+	if (index < LED_MAX_BRIGHTNESS)
+	{
+		duty += ((Led_GammaDuty[index + 1U] - duty) * ((Level >> 8U) & 0xFFU)) >> 8U;
+	}
+
+	return (uint16)duty;
+}
+
+/* Description: Store the 16.16 brightness and write its duty cycle to the PWM channel */
+static void LED_writeLevel(uint32 Level)
+{
+	g_Led_Level = Level;
+	Pwm_SetDutyCycle(LED_PWM_CHANNEL, LED_levelDuty(Level));
+	Pwm_SyncUpdate();
+}
+#endif
+
+/* Output of a LED */
+typedef struct
+{
+	uint8 Output; /* LED_OUTPUT_DIO or LED_OUTPUT_PWM */
+	uint8 Channel;
+} Led_OutputConfigType;
+
+/* Running pattern of a LED */
+typedef struct
+{
+	const Led_PatternType* Pattern; /* NULL_PTR when no pattern runs */
+	uint8				   Step;
+	uint8				   Repeats_Left; /* runs left with the current one (not used when forever) */
+	uint32				   Remaining;	 /* timer ticks until the next transition */
+} Led_PatternStateType;
+
+static const Led_OutputConfigType Led_Outputs[LED_CONFIGURED_LEDS] = {
+	[LedConf_LED1_ID] = {LedConf_LED1_OUTPUT, LedConf_LED1_CHANNEL},
+	[LedConf_LED2_ID] = {LedConf_LED2_OUTPUT, LedConf_LED2_CHANNEL},
+};
+
+static Led_PatternStateType g_Led_Patterns[LED_CONFIGURED_LEDS];
+
+/* Ticks loaded in the pattern timer, 0 while it is stopped */
+static uint32 g_Led_PatternInterval = 0;
+
+/* Number of timer ticks of a step */
+#define LED_STEP_TICKS(STEP) GPT_US_TO_TICKS((uint32)(STEP)->Duration_Ms * 1000U)
+
+/* Description: Set the output of a LED to the level of a pattern step */
+static void LED_applyLevel(uint8 LedId, uint8 Level)
+{
+#if (LED_PWM_API == STD_ON)
+	if ((LED_OUTPUT_PWM == Led_Outputs[LedId].Output) && (LED_PWM_CHANNEL == Led_Outputs[LedId].Channel))
+	{
+		LED_setBrightness(Level);
+	}
+	else if (LED_OUTPUT_PWM == Led_Outputs[LedId].Output)
+	{
+		Pwm_SetDutyCycle(Led_Outputs[LedId].Channel, Led_GammaDuty[Level]);
+		Pwm_SyncUpdate();
+	}
+	else
+#endif
+	{
+		Dio_WriteChannel(Led_Outputs[LedId].Channel, (0U != Level) ? LED_ON : LED_OFF);
+	}
+}
+
+/*
+ * Description: Move the patterns forward by Elapsed ticks. The LEDs whose transition is due go to their
+ *              next step, the time elapsed past the transition is taken from the step so that the
+ *              patterns do not drift with the latency of the timer interrupt.
+ */
+static void LED_advancePatterns(uint32 Elapsed)
+{
+	for (uint8 id = 0; id < LED_CONFIGURED_LEDS; id++)
+	{
+		Led_PatternStateType*  state = &g_Led_Patterns[id];
+		const Led_PatternType* pattern = state->Pattern;
+
+		if (NULL_PTR == pattern)
+		{
+			/* Do Nothing */
+		}
+		else if (state->Remaining > Elapsed)
+		{
+			state->Remaining -= Elapsed;
+		}
+		else
+		{
+			uint32 late = Elapsed - state->Remaining;
+
+			state->Step++;
+
+			if (state->Step >= pattern->Step_Count)
+			{
+				state->Step = 0;
+
+				if (LED_PATTERN_FOREVER != pattern->Repeat)
+				{
+					state->Repeats_Left--;
+				}
+			}
+
+			if ((LED_PATTERN_FOREVER != pattern->Repeat) && (0U == state->Repeats_Left))
+			{
+				/* Last run done, the LED keeps the level of the last step */
+				state->Pattern = NULL_PTR;
+			}
+			else
+			{
+				uint32 ticks = LED_STEP_TICKS(&pattern->Steps[state->Step]);
+
+				LED_applyLevel(id, pattern->Steps[state->Step].Level);
+				state->Remaining = (ticks > late) ? (ticks - late) : 1U;
+			}
+		}
+	}
+}
+
+/* Description: Load the pattern timer with the nearest transition, it stays stopped if no pattern runs */
+static void LED_schedulePatterns(void)
+{
+	uint32 next = 0;
+
+	for (uint8 id = 0; id < LED_CONFIGURED_LEDS; id++)
+	{
+		if ((NULL_PTR != g_Led_Patterns[id].Pattern) && ((0U == next) || (g_Led_Patterns[id].Remaining < next)))
+		{
+			next = g_Led_Patterns[id].Remaining;
+		}
+	}
+
+	g_Led_PatternInterval = next;
+
+	if (0U != next)
+	{
+		Gpt_StartTimer(LED_PATTERN_GPT_CHANNEL, next);
+	}
+}
+
+/*
+ * Description: Stop the pattern timer and account the ticks it ran. Its notification is disabled meanwhile,
+ *              so a time-out during the update only marks the channel expired and is counted here.
+ */
+static void LED_suspendPatterns(void)
+{
+	uint32 elapsed = 0;
+
+	Gpt_DisableNotification(LED_PATTERN_GPT_CHANNEL);
+
+	if (0U != g_Led_PatternInterval)
+	{
+		elapsed = Gpt_GetTimeElapsed(LED_PATTERN_GPT_CHANNEL);
+		Gpt_StopTimer(LED_PATTERN_GPT_CHANNEL);
+	}
+
+	LED_advancePatterns(elapsed);
+}
+
+/* Description: Reload the pattern timer and enable its notification again */
+static void LED_resumePatterns(void)
+{
+	LED_schedulePatterns();
+	Gpt_EnableNotification(LED_PATTERN_GPT_CHANNEL);
+}
+
 /*********************************************************************************************/
 void LED_setOn(void)
 {
-	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, LED_ON); /* LED ON */
+#if (LED_PWM_API == STD_ON)
+	LED_setBrightness(LED_MAX_BRIGHTNESS);
+#else
+	DIO_WRITE_CHANNEL(DioConf_LED1_CHANNEL_ID_INDEX, LED_ON); /* LED ON */
+#endif
 }
 
 /*********************************************************************************************/
 void LED_setOff(void)
 {
-	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, LED_OFF); /* LED OFF */
+#if (LED_PWM_API == STD_ON)
+	LED_setBrightness(0U);
+#else
+	DIO_WRITE_CHANNEL(DioConf_LED1_CHANNEL_ID_INDEX, LED_OFF); /* LED OFF */
+#endif
 }
 
+#if (LED_PWM_API == STD_OFF)
 /*********************************************************************************************/
 void LED_refreshOutput(void)
 {
-	Dio_LevelType state = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX);
-	Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, state); /* re-write the same value */
+	#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+	Dio_RefreshOutputs(); /* re-write the shadowed value, no read of the port */
+	#else
+	Dio_LevelType state = DIO_READ_CHANNEL(DioConf_LED1_CHANNEL_ID_INDEX);
+	DIO_WRITE_CHANNEL(DioConf_LED1_CHANNEL_ID_INDEX, state); /* re-write the same value */
+	#endif
 }
+#endif
 
 /*********************************************************************************************/
 void LED_toggle(void)
 {
-	Dio_LevelType state = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+#if (LED_PWM_API == STD_ON)
+	/* A fading LED toggles from the brightness it is heading to */
+	LED_setBrightness((0U != g_Led_Target) ? 0U : LED_MAX_BRIGHTNESS);
+#else
+	Dio_LevelType state = DIO_FLIP_CHANNEL(DioConf_LED1_CHANNEL_ID_INDEX);
+#endif
+}
+
+/*********************************************************************************************/
+void LED_init(void)
+{
+#if (LED_PWM_API == STD_ON)
+	Gpt_EnableNotification(LED_FADE_GPT_CHANNEL);
+#endif
+	Gpt_EnableNotification(LED_PATTERN_GPT_CHANNEL);
+}
+
+/*********************************************************************************************/
+void LED_startPattern(uint8 LedId, const Led_PatternType* Pattern)
+{
+	if ((LedId < LED_CONFIGURED_LEDS) && (NULL_PTR != Pattern) && (0U != Pattern->Step_Count))
+	{
+		Led_PatternStateType* state = &g_Led_Patterns[LedId];
+
+		LED_suspendPatterns();
+
+		state->Pattern = Pattern;
+		state->Step = 0;
+		state->Repeats_Left = Pattern->Repeat;
+		state->Remaining = LED_STEP_TICKS(&Pattern->Steps[0]);
+		LED_applyLevel(LedId, Pattern->Steps[0].Level);
+
+		LED_resumePatterns();
+	}
+}
+
+/*********************************************************************************************/
+void LED_stopPattern(uint8 LedId)
+{
+	if (LedId < LED_CONFIGURED_LEDS)
+	{
+		LED_suspendPatterns();
+		g_Led_Patterns[LedId].Pattern = NULL_PTR;
+		LED_resumePatterns();
+	}
+}
+
+/*********************************************************************************************/
+boolean LED_isPatternRunning(uint8 LedId)
+{
+	return ((LedId < LED_CONFIGURED_LEDS) && (NULL_PTR != g_Led_Patterns[LedId].Pattern)) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************/
+void LED_patternNotification(void)
+{
+	/* The one-shot channel expired after the whole interval it was loaded with */
+	uint32 elapsed = g_Led_PatternInterval;
+
+	g_Led_PatternInterval = 0;
+	LED_advancePatterns(elapsed);
+	LED_schedulePatterns();
+}
+
+#if (LED_PWM_API == STD_ON)
+/*********************************************************************************************/
+void LED_setBrightness(uint8 Level)
+{
+	Gpt_StopTimer(LED_FADE_GPT_CHANNEL);
+	g_Led_FadeSteps = 0;
+	g_Led_Target = Level;
+	LED_writeLevel((uint32)Level << 16U);
+}
+
+/*********************************************************************************************/
+void LED_fadeTo(uint8 Level, uint16 TimeMs)
+{
+	uint16 steps = TimeMs / LED_FADE_STEP_MS;
+
+	if (0U == steps)
+	{
+		LED_setBrightness(Level);
+	}
+	else
+	{
+		/* The fade starts from the current brightness, also in the middle of another fade */
+		Gpt_StopTimer(LED_FADE_GPT_CHANNEL);
+		g_Led_Target = Level;
+		g_Led_FadeStep = ((sint32)((uint32)Level << 16U) - (sint32)g_Led_Level) / (sint32)steps;
+		g_Led_FadeSteps = steps;
+		Gpt_StartTimer(LED_FADE_GPT_CHANNEL, GPT_US_TO_TICKS(LED_FADE_STEP_MS * 1000U));
+	}
+}
+
+/*********************************************************************************************/
+uint8 LED_getBrightness(void)
+{
+	return (uint8)(g_Led_Level >> 16U);
+}
+
+/*********************************************************************************************/
+void LED_fadeNotification(void)
+{
+	if (0U != g_Led_FadeSteps)
+	{
+		g_Led_FadeSteps--;
+
+		if (0U == g_Led_FadeSteps)
+		{
+			/* Last step: land exactly on the target and stop the timer until the next fade */
+			Gpt_StopTimer(LED_FADE_GPT_CHANNEL);
+			LED_writeLevel((uint32)g_Led_Target << 16U);
+		}
+		else
+		{
+			LED_writeLevel((uint32)((sint32)g_Led_Level + g_Led_FadeStep));
+		}
+	}
+}
+#endif
+
+#if (LED_RGB_API == STD_ON)
+/*********************************************************************************************/
+void LED_setColor(uint8 Red, uint8 Green, uint8 Blue)
+{
+	Gpt_StopTimer(LED_FADE_GPT_CHANNEL);
+	g_Led_FadeSteps = 0;
+	g_Led_Target = Red;
+	g_Led_Level = (uint32)Red << 16U;
+
+	/* The generators keep the new duty cycles pending until the single global update */
+	Pwm_SetDutyCycle(LED_RED_PWM_CHANNEL, Led_GammaDuty[Red]);
+	Pwm_SetDutyCycle(LED_GREEN_PWM_CHANNEL, Led_GammaDuty[Green]);
+	Pwm_SetDutyCycle(LED_BLUE_PWM_CHANNEL, Led_GammaDuty[Blue]);
+	Pwm_SyncUpdate();
+}
+
+/*********************************************************************************************/
+void LED_setHsv(uint16 Hue, uint8 Saturation, uint8 Value)
+{
+	Led_ColorType color;
+
+	LED_hsvToRgb(Hue, Saturation, Value, &color);
+	LED_setColor(color.Red, color.Green, color.Blue);
+}
+
+/*********************************************************************************************/
+void LED_hsvToRgb(uint16 Hue, uint8 Saturation, uint8 Value, Led_ColorType* Color)
+{
+	/* The hue circle is split into six regions of 60 degrees, fraction is the position in the region */
+	uint32 hue = (uint32)Hue % 360U;
+	uint32 region = hue / 60U;
+	uint32 fraction = ((hue % 60U) * LED_MAX_BRIGHTNESS) / 60U;
+	uint32 rising = LED_MAX_BRIGHTNESS - ((Saturation * (LED_MAX_BRIGHTNESS - fraction)) / LED_MAX_BRIGHTNESS);
+	uint32 falling = LED_MAX_BRIGHTNESS - ((Saturation * fraction) / LED_MAX_BRIGHTNESS);
+	uint8  p = (uint8)(((uint32)Value * (LED_MAX_BRIGHTNESS - Saturation)) / LED_MAX_BRIGHTNESS);
+	uint8  q = (uint8)(((uint32)Value * falling) / LED_MAX_BRIGHTNESS);
+	uint8  t = (uint8)(((uint32)Value * rising) / LED_MAX_BRIGHTNESS);
+
+	switch (region)
+	{
+		case 0U:
+			*Color = (Led_ColorType){Value, t, p};
+			break;
+		case 1U:
+			*Color = (Led_ColorType){q, Value, p};
+			break;
+		case 2U:
+			*Color = (Led_ColorType){p, Value, t};
+			break;
+		case 3U:
+			*Color = (Led_ColorType){p, q, Value};
+			break;
+		case 4U:
+			*Color = (Led_ColorType){t, p, Value};
+			break;
+		default:
+			*Color = (Led_ColorType){Value, p, q};
+			break;
+	}
 }
+#endif
 
 /*********************************************************************************************/
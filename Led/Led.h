@@ -12,10 +12,45 @@
 #define LED_H
 
 #include "Std_Types.h"
+#include "Led_Cfg.h"
 
 /* Set the led ON/OFF according to its configuration Positive logic or negative logic */
-#define LED_ON	STD_HIGH
-#define LED_OFF STD_LOW
+#define LED_ON				STD_HIGH
+#define LED_OFF				STD_LOW
+
+/* Brightness of the LED fully on */
+#define LED_MAX_BRIGHTNESS	(255U)
+
+/* Output types of LedConf_xxx_OUTPUT */
+#define LED_OUTPUT_DIO		(0U)
+#define LED_OUTPUT_PWM		(1U)
+
+/* Repeat count of a pattern that runs until it is stopped or replaced */
+#define LED_PATTERN_FOREVER	(0U)
+
+/* Color of the RGB LED, every channel from 0 to LED_MAX_BRIGHTNESS */
+typedef struct
+{
+	uint8 Red;
+	uint8 Green;
+	uint8 Blue;
+} Led_ColorType;
+
+/* One step of a pattern: the LED stays at Level for Duration_Ms (1 to 65535 ms) */
+typedef struct
+{
+	uint8  Level;
+	uint16 Duration_Ms;
+} Led_StepType;
+
+/* Run-length pattern, the steps are played Repeat times (LED_PATTERN_FOREVER for no end) and the LED
+ * keeps the level of the last step when the pattern ends */
+typedef struct
+{
+	const Led_StepType* Steps;
+	uint8				Step_Count;
+	uint8				Repeat;
+} Led_PatternType;
 
 /* Description: Set the LED state to ON */
 void LED_setOn(void);
@@ -26,7 +61,57 @@ void LED_setOff(void);
 /*Description: Toggle the LED state */
 void LED_toggle(void);
 
-/* Description: Refresh the LED state */
+#if (LED_PWM_API == STD_OFF)
+/* Description: Refresh the LED state, only for a LED on a Dio output: the PWM outputs are driven by
+ * the PWM generators, the Dio shadow does not reach them */
 void LED_refreshOutput(void);
+#endif
+
+/* Description: Enable the fade and pattern timer notifications, Pwm_Init and Gpt_Init must be called before */
+void LED_init(void);
+
+/* Description: Start Pattern on the LED LedId (LedConf_xxx_ID) from its first step, it replaces the running
+ *              pattern of the LED. Only the next transition of all the patterns is scheduled on the one-shot
+ *              LED_PATTERN_GPT_CHANNEL, nothing runs between two transitions. */
+void LED_startPattern(uint8 LedId, const Led_PatternType* Pattern);
+
+/* Description: Stop the pattern of the LED LedId, the LED keeps its current level */
+void LED_stopPattern(uint8 LedId);
+
+/* Description: Check if a pattern is running on the LED LedId */
+boolean LED_isPatternRunning(uint8 LedId);
+
+/* Description: Gpt notification of LED_PATTERN_GPT_CHANNEL, applies the transitions that are due */
+void LED_patternNotification(void);
+
+#if (LED_PWM_API == STD_ON)
+/* Description: Set the brightness (0 to LED_MAX_BRIGHTNESS) now, a running fade is stopped */
+void LED_setBrightness(uint8 Level);
+
+/* Description: Move the brightness linearly to Level in TimeMs, the duty cycle is updated every
+ *              LED_FADE_STEP_MS and the waveform itself is generated by the PWM hardware */
+void LED_fadeTo(uint8 Level, uint16 TimeMs);
+
+/* Description: Read the current brightness */
+uint8 LED_getBrightness(void);
+
+/* Description: Gpt notification of LED_FADE_GPT_CHANNEL, one step of the running fade */
+void LED_fadeNotification(void);
+#endif
+
+#if (LED_RGB_API == STD_ON)
+/* Description: Set the color of the RGB LED, a running fade is stopped. The three duty cycles are
+ *              taken by the PWM generators at the end of the same period (Pwm_SyncUpdate), so no
+ *              mix of the old and new colors is ever shown. The red level is the LED1 brightness
+ *              and the blue level the LED2 one, a pattern running on them overrides the color. */
+void LED_setColor(uint8 Red, uint8 Green, uint8 Blue);
+
+/* Description: Set the color of the RGB LED from Hue (0 to 359 degrees), Saturation and Value
+ *              (0 to LED_MAX_BRIGHTNESS) */
+void LED_setHsv(uint16 Hue, uint8 Saturation, uint8 Value);
+
+/* Description: Convert a Hue (0 to 359 degrees, taken modulo 360), Saturation and Value to RGB */
+void LED_hsvToRgb(uint16 Hue, uint8 Saturation, uint8 Value, Led_ColorType* Color);
+#endif
 
 #endif /* LED_H */
@@ -12,11 +12,76 @@
 #define LED_CFG_H
 
 #include "Dio.h"
+#include "Pwm.h"
+#include "Gpt.h"
 
 /* Set the LED Port */
-#define LED_PORT	DioConf_LED1_PORT_NUM
+#define LED_PORT				DioConf_LED1_PORT_NUM
 
 /* Set the LED Pin Number */
-#define LED_PIN_NUM DioConf_LED1_CHANNEL_NUM
+#define LED_PIN_NUM				DioConf_LED1_CHANNEL_NUM
+
+/*
+ * STD_ON : the LED is driven by the PWM channel LED_PWM_CHANNEL (brightness and fades), its pin
+ *          must be in the PWM mode in Port_Cfg.h (PF1 = M1PWM5)
+ * STD_OFF: the LED is a Dio output, on or off
+ */
+#define LED_PWM_API				STD_ON
+
+/* Pwm channel of the LED (red channel of the RGB LED) */
+#define LED_PWM_CHANNEL			PwmConf_LED_RED_CHANNEL_ID_INDEX
+
+/*
+ * STD_ON : LED_setColor/LED_setHsv drive the three channels of the RGB LED (PF1, PF3, PF2 = M1PWM5,
+ *          M1PWM7, M1PWM6), the PWM channels must be PWM_UPDATE_SYNC so that a color change is
+ *          applied at once. Needs LED_PWM_API.
+ * STD_OFF: only the red channel is used
+ */
+#define LED_RGB_API				STD_ON
+
+/* Pwm channels of the RGB LED */
+#define LED_RED_PWM_CHANNEL		PwmConf_LED_RED_CHANNEL_ID_INDEX
+#define LED_GREEN_PWM_CHANNEL	PwmConf_LED_GREEN_CHANNEL_ID_INDEX
+#define LED_BLUE_PWM_CHANNEL	PwmConf_LED_BLUE_CHANNEL_ID_INDEX
+
+#if ((LED_RGB_API == STD_ON) && (LED_PWM_API != STD_ON))
+	#error "LED_RGB_API needs LED_PWM_API"
+#endif
+
+/* Gpt channel giving the duty cycle updates of the fades, it only runs during a fade */
+#define LED_FADE_GPT_CHANNEL	GptConf_LED_CHANNEL_ID_INDEX
+
+/* Period of the duty cycle updates during a fade */
+#define LED_FADE_STEP_MS		(10U)
+
+/* Number of LEDs that can run a pattern */
+#define LED_CONFIGURED_LEDS		(2U)
+
+/* LED Index in the patterns table */
+#define LedConf_LED1_ID			(uint8)0
+#define LedConf_LED2_ID			(uint8)1
+
+/*
+ * Output of every LED and its channel:
+ * LED_OUTPUT_PWM: the level of a pattern step is the brightness (through LED_setBrightness for LED1)
+ * LED_OUTPUT_DIO: the LED is on when the level of a pattern step is not 0
+ */
+#if (LED_PWM_API == STD_ON)
+	#define LedConf_LED1_OUTPUT	 LED_OUTPUT_PWM
+	#define LedConf_LED1_CHANNEL LED_PWM_CHANNEL
+#else
+	#define LedConf_LED1_OUTPUT	 LED_OUTPUT_DIO
+	#define LedConf_LED1_CHANNEL DioConf_LED1_CHANNEL_ID_INDEX
+#endif
+#if (LED_RGB_API == STD_ON)
+	#define LedConf_LED2_OUTPUT	 LED_OUTPUT_PWM
+	#define LedConf_LED2_CHANNEL LED_BLUE_PWM_CHANNEL
+#else
+	#define LedConf_LED2_OUTPUT	 LED_OUTPUT_DIO
+	#define LedConf_LED2_CHANNEL DioConf_LED2_CHANNEL_ID_INDEX
+#endif
+
+/* One-shot Gpt channel expiring at the next transition of the running patterns */
+#define LED_PATTERN_GPT_CHANNEL	GptConf_LED_PATTERN_CHANNEL_ID_INDEX
 
 #endif /* LED_CFG_H */
@@ -14,6 +14,7 @@
 #include "Button.h"
 #include "Led.h"
 #include "SysTick.h"
+#include "Irq.h"
 
 /* Enable IRQ Interrupts ... This Macro enables IRQ interrupts by clearing the I-bit in the PRIMASK. */
 #define Enable_Interrupts()	 __asm("CPSIE I")
@@ -24,24 +25,29 @@
 /* Global variable store the Os Time */
 static uint8 g_Time_Tick_Count = 0;
 
+/* Global variable store the time since Os_start in ms, read by Os_GetTime */
+static volatile uint32 g_Os_Time_Ms = 0;
+
 /* Global variable to indicate the the timer has a new tick */
 static uint8 g_New_Time_Tick_Flag = 0;
 
 /*********************************************************************************************/
 void Os_start(void)
 {
+	/* Move the vector table to the SRAM before any handler is installed */
+	Irq_Init();
+
 	/* Global Interrupts Enable */
 	Enable_Interrupts();
 
 	/* 
-     * Set the Call Back function to call Os_NewTimerTick
-     * this function will be called every SysTick Interrupt (20ms)
+     * Install Os_NewTimerTick as the SysTick handler
+     * this function will be called every SysTick Interrupt (20ms) without a call back in between
      */
-	SysTick_SetCallBack(Os_NewTimerTick);
+	(void)Irq_Install(IRQ_SYSTICK, Os_NewTimerTick, SYSTICK_PRIORITY);
 
 	/* Start SysTickTimer to generate interrupt every 20ms */
 	SysTick_init(&SysTick_Configuration, OS_BASE_TIME);
-	SysTick_SetPriority(SYSTICK_PRIORITY);
 
 	/* Execute the Init Task */
 	Init_Task();
@@ -50,16 +56,28 @@ void Os_start(void)
 	Os_Scheduler();
 }
 
+/* The tick and the dispatch run every 20 ms for the whole life of the application, they are executed
+ * from the SRAM so that their timing does not depend on the flash wait states */
+#define OS_START_SEC_CODE_FAST
+#include "Os_MemMap.h"
+
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
 	/* Increment the Os time by OS_BASE_TIME */
 	g_Time_Tick_Count += OS_BASE_TIME;
+	g_Os_Time_Ms += OS_BASE_TIME;
 
 	/* Set the flag to 1 to indicate that there is a new timer tick */
 	g_New_Time_Tick_Flag = 1;
 }
 
+/*********************************************************************************************/
+uint32 Os_GetTime(void)
+{
+	return g_Os_Time_Ms;
+}
+
 /*********************************************************************************************/
 void Os_Scheduler(void)
 {
@@ -90,6 +108,7 @@ void Os_Scheduler(void)
 					Button_Task();
 					App_Task();
 					Led_Task();
+					Dem_Task();
 					g_New_Time_Tick_Flag = 0;
 					g_Time_Tick_Count = 0;
 					break;
@@ -98,3 +117,6 @@ void Os_Scheduler(void)
 	}
 }
 /*********************************************************************************************/
+
+#define OS_STOP_SEC_CODE_FAST
+#include "Os_MemMap.h"
@@ -29,7 +29,10 @@ void Os_start(void);
 /* Description: The Engine of the Os Scheduler used for switch between different tasks */
 void Os_Scheduler(void);
 
-/* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
+/* Description: SysTick handler of the Os, installed in the vector table by Os_start */
 void Os_NewTimerTick(void);
 
+/* Description: Return the time since the Os started in ms, incremented by OS_BASE_TIME every tick */
+uint32 Os_GetTime(void);
+
 #endif /* OS_H_ */
@@ -0,0 +1,20 @@
+/******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_MemMap.h
+ *
+ * Description: Memory mapping of the Os, included several times on purpose (no include guard).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#if defined(OS_START_SEC_CODE_FAST)
+	#undef OS_START_SEC_CODE_FAST
+	#define START_SEC_CODE_FAST
+#elif defined(OS_STOP_SEC_CODE_FAST)
+	#undef OS_STOP_SEC_CODE_FAST
+	#define STOP_SEC_CODE_FAST
+#endif
+
+#include "MemMap.h"
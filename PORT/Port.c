@@ -31,48 +31,49 @@
 /* Number defined by the TM4C123GH6PM MCU creators to unlock GPIO Commit Register */
 #define UNLOCK_GPIOCR ((uint32)0x4C4F434B)
 
-/* Mask of the 4 bits of the PMCx bits in the GPIOAFSEL register */
+/* Mask of the 4 bits of the PMCx bits in the GPIOPCTL register */
 #define BYTE_MASK	  ((uint32)0x0000000F)
 
-/* Macros to write value to the PMCx bits in the GPIOAFSEL register */
-#define WRITE_PMCx_VALUE(PORT, BIT, VALUE) \
-	(*GPIOPCTL[PORT] = ((*GPIOPCTL[PORT] & ~(BYTE_MASK << (BIT * 4))) | (VALUE << (BIT * 4))))
+/* Macro to replace the bits of MASK in a register by VALUE with one read and one write */
+#define WRITE_MASKED_VALUE(REG, MASK, VALUE) ((REG) = (((REG) & ~(uint32)(MASK)) | (uint32)(VALUE)))
 
 /************************************************************************************
  * 								Private Functions									*
  ************************************************************************************/
 
 /************************************************************************************
- * Description : The function GPIO_unlock unlocks a specific GPIO pin on a given port.
+ * Description : The function GPIO_unlock unlocks the locked GPIO pins of a given port.
  * 
  * @param port The port parameter is the number of the GPIO port that you want to unlock. It is
  * typically represented as a number from 0 to 7, where each number corresponds to a specific GPIO port
  * on the microcontroller.
- * @param pin The pin number of the GPIO port that needs to be unlocked.
+ * @param pins_mask The mask of the pins of the GPIO port that need to be unlocked.
  ************************************************************************************/
-static void GPIO_unlock(uint8 port, uint8 pin)
+static void GPIO_unlock(uint8 port, uint8 pins_mask)
 {
 	/* Unlock the GPIO_CR register */
-	*GPIOLOCK[port] = UNLOCK_GPIOCR;
+	GPIO_PORT(port)->LOCK = UNLOCK_GPIOCR;
 	/* Allow changes on GPIO_CR register */
-	SET_BIT(*GPIOCR[port], pin);
+	SET_MASK(GPIO_PORT(port)->CR, pins_mask);
 }
 
 /************************************************************************************
- * Description : The function GPIO_clk_enable enables the clock for a given port in C.
+ * Description : The function GPIO_clk_enable enables the clock of the given ports in one write and
+ * waits until all of them are ready to be accessed.
  * 
- * @param port The parameter "port" is a uint8 variable that represents the port number for which the
- * clock needs to be enabled.
+ * @param ports_mask The parameter "ports_mask" has one bit set for every port number whose clock
+ * needs to be enabled, the clock of the other ports is left as it is.
  ************************************************************************************/
-static void GPIO_clk_enable(uint8 port)
+static void GPIO_clk_enable(uint8 ports_mask)
 {
-	/* Enable the clock for the given port */
+	/* Enable the clock for the given ports */
+	SET_MASK(RCGCGPIO, ports_mask);
 
-	//SET_MASK(RCGCGPIO, BIT(g_Port_ConfigPtr[ID].Port_Number));
-	SET_MASK(RCGCGPIO, BIT(port));
-
-	/* delay to make sure that the clock is enabled */
-	volatile uint32 delay = RCGCGPIO;
+	/* Wait until the ports report that they are ready */
+	while ((PRGPIO & ports_mask) != ports_mask)
+	{
+		/* Do Nothing */
+	}
 }
 
 /************************************************************************************
@@ -81,6 +82,31 @@ static void GPIO_clk_enable(uint8 port)
 STATIC const Port_ConfigPins* g_Port_ConfigPtr = NULL_PTR;
 STATIC uint8				  g_Port_Status = PORT_NOT_INITIALIZED;
 
+STATIC const Port_PortImageType* g_Port_ImagesPtr = NULL_PTR;
+
+#if (STD_ON == PORT_APPLY_PROFILE_API)
+STATIC const Port_ProfileType* g_Port_ProfilesPtr = NULL_PTR;
+#endif
+
+#if (STD_ON == PORT_DIRECTION_DRIFT_DETECT)
+/* Pins found with a wrong direction by Port_RefreshPortDirection, cleared by Port_GetDirectionDrift.
+ * Indexed by GPIO port number, the configured images may be in any order. */
+STATIC uint8 g_Port_DirectionDrift[NUMBER_OF_PORTS];
+#endif
+
+#if ((STD_ON == PORT_SET_PIN_DIRECTION_API) || (STD_ON == PORT_SET_PIN_MODE_API))
+/* Registers and bits of one pin resolved once by Port_Init, the runtime setters only do the stores */
+typedef struct
+{
+	volatile GPIO_RegType* Regs;	   /* registers of the port of the pin */
+	uint32				   Pctl_Mask;  /* PMCx nibble of the pin in GPIOPCTL */
+	uint8				   Mask;	   /* bit of the pin in the other registers */
+	uint8				   Pctl_Shift; /* position of the PMCx nibble */
+} Port_PinDescriptorType;
+
+STATIC Port_PinDescriptorType g_Port_PinDescriptors[PORT_CONFIGURED_PINS];
+#endif
+
 /************************************************************************************
 * Service Name		: Port_Init
 * Service ID[hex]	: 0x00
@@ -108,122 +134,92 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
 #endif
 	/* In-case there are no errors */
 	{
+		uint8 UsedPorts = STD_LOW;
+
 		/* Save the PB configuration structure pointer in a global pointer so that it can be used by
 		 * other functions to read the PB configuration structures and point to  
 		 * the first Port_ConfigPins structure --> Port_Configuration.Pins[0]*/
 		g_Port_ConfigPtr = ConfigPtr->Pins;
+		g_Port_ImagesPtr = ConfigPtr->Ports;
 
-		/* Loop through all the pins in the Pins structure */
-		for (uint8 ID = STD_LOW; ID < PORT_CONFIGURED_PINS; ID++)
-		{
-			/**************************** Clock Enable ********************************/
-			GPIO_clk_enable(g_Port_ConfigPtr[ID].Port_Number);
+#if (STD_ON == PORT_APPLY_PROFILE_API)
+		g_Port_ProfilesPtr = ConfigPtr->Profiles;
+#endif
 
-			/**************************** Unlock GPIOCR *******************************/
-			/* Unlock GPIOCR for PD7 or PF0 */
-			if ((PORTF == g_Port_ConfigPtr[ID].Port_Number && PIN0 == g_Port_ConfigPtr[ID].Pin_Number) ||
-				(PORTD == g_Port_ConfigPtr[ID].Port_Number && PIN7 == g_Port_ConfigPtr[ID].Pin_Number))
-			{
-				GPIO_unlock(g_Port_ConfigPtr[ID].Port_Number, g_Port_ConfigPtr[ID].Pin_Number);
-			}
-			/* PC0 to PC3 - JTAG pins */
-			else if (PORTC == g_Port_ConfigPtr[ID].Port_Number && PIN3 >= g_Port_ConfigPtr[ID].Pin_Number)
+		/**************************** Clock Enable ********************************/
+		/* Only the ports with configured pins are clocked, the others stay gated */
+		for (uint8 PortIndex = STD_LOW; PortIndex < PORT_CONFIGURED_PORTS; PortIndex++)
+		{
+			if (STD_LOW != ConfigPtr->Ports[PortIndex].Pins_Mask)
 			{
-				/* Do Nothing ...  this is the JTAG pins */
+				SET_BIT(UsedPorts, ConfigPtr->Ports[PortIndex].Port_Number);
 			}
 			else
 			{
-				/* Do Nothing ... No need to unlock the commit register for this pin */
+				/* Do Nothing */
 			}
+		}
 
-			/**************************** Direction ***********************************/
-			if (PORT_PIN_OUT == (Port_PinDirectionType)g_Port_ConfigPtr[ID].Pin_Direction)
-			{
-				SET_BIT(*GPIODIR[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
+		GPIO_clk_enable(UsedPorts);
 
-				/**************************** Initial Value *******************************/
-				if (STD_HIGH == g_Port_ConfigPtr[ID].Pin_Initial_Value)
-				{
-					SET_BIT(*GPIODATA[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
-				}
-				else if (STD_LOW == g_Port_ConfigPtr[ID].Pin_Initial_Value)
-				{
-					CLEAR_BIT(*GPIODATA[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
-				}
-				else
-				{
-					/* Do Nothing */
-				}
-			}
-			else if (PORT_PIN_IN == (Port_PinDirectionType)g_Port_ConfigPtr[ID].Pin_Direction)
-			{
-				CLEAR_BIT(*GPIODIR[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
+		/* Every port is written from its register image, one access per register instead of one
+		 * read-modify-write per pin and register */
+		for (uint8 PortIndex = STD_LOW; PortIndex < PORT_CONFIGURED_PORTS; PortIndex++)
+		{
+			const Port_PortImageType* Image = &ConfigPtr->Ports[PortIndex];
+			uint8					  Port = Image->Port_Number;
+			uint8					  InputPins = (uint8)(Image->Pins_Mask & ~Image->Dir);
+			volatile GPIO_RegType*	  Regs = GPIO_PORT(Port);
 
-				//**************************** Resistor ************************************
-				if (g_Port_ConfigPtr[ID].Pin_Resistor == PULL_UP)
-				{
-					/* Enable the internal pull up resistor for the selected pin */
-					SET_BIT(*GPIOPUR[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
-				}
-				else if (g_Port_ConfigPtr[ID].Pin_Resistor == PULL_DOWN)
+			if (STD_LOW != Image->Pins_Mask)
+			{
+				/**************************** Unlock GPIOCR *******************************/
+				/* PD7 or PF0, PC0 to PC3 (JTAG pins) are never part of the image */
+				if (STD_LOW != Image->Commit)
 				{
-					SET_BIT(*GPIOPDR[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
+					GPIO_unlock(Port, Image->Commit);
 				}
 				else
 				{
-					CLEAR_BIT(*GPIOPUR[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
-					CLEAR_BIT(*GPIOPDR[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
+					/* Do Nothing ... No need to unlock the commit register for this port */
 				}
-			}
-			else
-			{
-				/* Do Nothing */
-			}
 
-			//**************************** Mode Select ********************************
-			/* Check if the pin is a GPIO pin or analog pin */
-			if ((PORT_GPIO_MODE == (Port_PinMode)g_Port_ConfigPtr[ID].Pin_Mode) ||
-				(ADC_MODE_ID == (Port_PinMode)g_Port_ConfigPtr[ID].Pin_Mode) ||
-				(ANALOG_COMPARATOR_MODE_ID == (Port_PinMode)g_Port_ConfigPtr[ID].Pin_Mode) ||
-				(ANALOG_MODE_ID == (Port_PinMode)g_Port_ConfigPtr[ID].Pin_Mode))
-			{
-				/* Disable alternate function */
-				CLEAR_BIT(*GPIOAFSEL[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
+				/**************************** Initial Value *******************************/
+				/* Written before the direction so that the outputs start driving their configured level */
+				Regs->DATA[Image->Dir] = Image->Data;
 
-				/* Clear PMCx bits for the selected pin to use it as GPIO pin */
-				WRITE_PMCx_VALUE(g_Port_ConfigPtr[ID].Port_Number, g_Port_ConfigPtr[ID].Pin_Number, STD_LOW);
+				/**************************** Direction ***********************************/
+				WRITE_MASKED_VALUE(Regs->DIR, Image->Pins_Mask, Image->Dir);
 
-				/************************* GPIO Mode **********************************/
-				if (PORT_GPIO_MODE == (Port_PinMode)g_Port_ConfigPtr[ID].Pin_Mode)
-				{
-					/* Disable analog mode */
-					CLEAR_BIT(*GPIOAMSEL[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
-					/* Enable digital mode */
-					SET_BIT(*GPIODEN[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
-				}
-				/************************* Analog Mode **********************************/
-				else
-				{
-					/* Enable analog mode */
-					SET_BIT(*GPIOAMSEL[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
-					/* Disable digital mode */
-					CLEAR_BIT(*GPIODEN[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
-				}
+				/**************************** Resistor ************************************/
+				WRITE_MASKED_VALUE(Regs->PUR, InputPins, Image->Pur);
+				WRITE_MASKED_VALUE(Regs->PDR, InputPins, Image->Pdr);
+
+				/**************************** Mode Select ********************************/
+				WRITE_MASKED_VALUE(Regs->AMSEL, Image->Pins_Mask, Image->Amsel);
+				WRITE_MASKED_VALUE(Regs->PCTL, Image->Pctl_Mask, Image->Pctl);
+				WRITE_MASKED_VALUE(Regs->AFSEL, Image->Pins_Mask, Image->Afsel);
+				WRITE_MASKED_VALUE(Regs->DEN, Image->Pins_Mask, Image->Den);
 			}
-			else /* alternate function pin */
+			else
 			{
-				/* Enable alternate function */
-				SET_BIT(*GPIOAFSEL[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
-				/* Set PMCx bits for the selected pin to use it as the selected alternate function */
-				WRITE_PMCx_VALUE(g_Port_ConfigPtr[ID].Port_Number, g_Port_ConfigPtr[ID].Pin_Number,
-								 g_Port_ConfigPtr[ID].Pin_Mode);
-				/* Disable analog mode */
-				CLEAR_BIT(*GPIOAMSEL[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
-				/* Enable digital mode */
-				SET_BIT(*GPIODEN[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
+				/* Do Nothing ... No configured pins on this port */
 			}
 		}
 
+#if ((STD_ON == PORT_SET_PIN_DIRECTION_API) || (STD_ON == PORT_SET_PIN_MODE_API))
+		/* Resolve the registers of every pin for the runtime setters */
+		for (Port_PinType Pin = STD_LOW; Pin < PORT_CONFIGURED_PINS; Pin++)
+		{
+			uint8 PinNumber = PORT_CFG_PIN(g_Port_ConfigPtr[Pin]);
+
+			g_Port_PinDescriptors[Pin].Regs = GPIO_PORT(PORT_CFG_PORT(g_Port_ConfigPtr[Pin]));
+			g_Port_PinDescriptors[Pin].Mask = (uint8)BIT(PinNumber);
+			g_Port_PinDescriptors[Pin].Pctl_Shift = (uint8)(PinNumber * 4U);
+			g_Port_PinDescriptors[Pin].Pctl_Mask = BYTE_MASK << (PinNumber * 4U);
+		}
+#endif
+
 		/*
 		 	* Set the module state to initialized
 		 	*/
@@ -271,8 +267,8 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
 		/* Do Nothing */
 	}
 
-	/* Check if the input pin is not configured as changeable */
-	if (STD_OFF == g_Port_ConfigPtr[Pin].Pin_Direction_Changeable)
+	/* Check if the input pin is not configured as changeable (valid pin and initialized driver only) */
+	if ((FALSE == error) && (STD_OFF == PORT_CFG_DIRECTION_CHANGE(g_Port_ConfigPtr[Pin])))
 	{
 		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID,
 						PORT_E_DIRECTION_UNCHANGEABLE);
@@ -287,14 +283,16 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
 	/* In-case there are no errors */
 	if (FALSE == error)
 	{
+		const Port_PinDescriptorType* Descriptor = &g_Port_PinDescriptors[Pin];
+
 		/**************************** Direction ***********************************/
 		if (PORT_PIN_OUT == Direction)
 		{
-			SET_BIT(*GPIODIR[g_Port_ConfigPtr[Pin].Port_Number], g_Port_ConfigPtr[Pin].Pin_Number);
+			SET_MASK(Descriptor->Regs->DIR, Descriptor->Mask);
 		}
 		else if (PORT_PIN_IN == Direction)
 		{
-			CLEAR_BIT(*GPIODIR[g_Port_ConfigPtr[Pin].Port_Number], g_Port_ConfigPtr[Pin].Pin_Number);
+			CLEAR_MASK(Descriptor->Regs->DIR, Descriptor->Mask);
 		}
 		else
 		{
@@ -331,24 +329,66 @@ void Port_RefreshPortDirection(void)
 	else
 #endif
 	{
-		for (uint8 ID = STD_LOW; ID < PORT_CONFIGURED_PINS; ID++)
+		/* Only the pins with a fixed direction are refreshed, the changeable ones keep the direction
+		 * set by Port_SetPinDirection. One read and one write of GPIODIR per port. */
+		for (uint8 PortIndex = STD_LOW; PortIndex < PORT_CONFIGURED_PORTS; PortIndex++)
 		{
-			/**************************** Direction ***********************************/
-			if (PORT_PIN_OUT == g_Port_ConfigPtr[ID].Pin_Direction)
-			{
-				SET_BIT(*GPIODIR[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
-			}
-			else if (PORT_PIN_IN == g_Port_ConfigPtr[ID].Pin_Direction)
+			const Port_PortImageType* Image = &g_Port_ImagesPtr[PortIndex];
+
+			if (STD_LOW != Image->Dir_Fixed)
 			{
-				CLEAR_BIT(*GPIODIR[g_Port_ConfigPtr[ID].Port_Number], g_Port_ConfigPtr[ID].Pin_Number);
+				volatile uint32* Dir = &GPIO_PORT(Image->Port_Number)->DIR;
+				uint32			 Current = *Dir;
+
+#if (STD_ON == PORT_DIRECTION_DRIFT_DETECT)
+				/* Pins that lost their configured direction since the last refresh */
+				g_Port_DirectionDrift[Image->Port_Number] |= (uint8)((Current ^ Image->Dir) & Image->Dir_Fixed);
+#endif
+
+				*Dir = (Current & ~(uint32)Image->Dir_Fixed) | (uint32)(Image->Dir & Image->Dir_Fixed);
 			}
 			else
 			{
-				/* Do Nothing */
+				/* Do Nothing ... All pins of the port have a changeable direction */
 			}
 		}
 	}
 }
+
+/************************************************************************************
+* Service Name		: Port_GetDirectionDrift
+* Service ID[hex]	: 0x06
+* Sync/Async		: Synchronous
+* Reentrancy		: Non Reentrant
+* Parameters (in)	: PortNum - GPIO port number (PORTA to PORTF)
+* Parameters (inout): None
+* Parameters (out)	: None
+* Return value		: uint8 - pins of the port found with a wrong direction by
+*					  Port_RefreshPortDirection since the last call
+* Description		: Function to read and clear the direction drift of a port
+************************************************************************************/
+#if (STD_ON == PORT_DIRECTION_DRIFT_DETECT)
+uint8 Port_GetDirectionDrift(uint8 PortNum)
+{
+	uint8 Drift = STD_LOW;
+
+	#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input port number is within the valid range */
+	if (PortNum >= NUMBER_OF_PORTS)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_DIRECTION_DRIFT_SID, PORT_E_PARAM_PORT);
+	}
+	else
+	#endif
+	{
+		Drift = g_Port_DirectionDrift[PortNum];
+		g_Port_DirectionDrift[PortNum] = STD_LOW;
+	}
+
+	return Drift;
+}
+#endif /* PORT_DIRECTION_DRIFT_DETECT */
+
 /************************************************************************************
 * Service Name		: Port_GetVersionInfo
 * Service ID[hex]	: 0x03
@@ -426,8 +466,9 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 		/* Do Nothing */
 	}
 
-	/* Check if the input pin is not configured as changeable */
-	if (STD_OFF == g_Port_ConfigPtr[Pin].Pin_Mode_Changeable)
+	/* Check if the input pin is not configured as changeable (valid pin and initialized driver only) */
+	if ((Pin < PORT_CONFIGURED_PINS) && (PORT_INITIALIZED == g_Port_Status) &&
+		(STD_OFF == PORT_CFG_MODE_CHANGE(g_Port_ConfigPtr[Pin])))
 	{
 		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
 		error = TRUE;
@@ -451,43 +492,46 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 
 	/* In-case there are no errors */
 	if (FALSE == error)
-	{ /* Check if the pin is a GPIO pin or analog pin */
+	{
+		const Port_PinDescriptorType* Descriptor = &g_Port_PinDescriptors[Pin];
+
+		/* Check if the pin is a GPIO pin or analog pin */
 		if ((PORT_GPIO_MODE == Mode) || (ADC_MODE_ID == Mode) || (ANALOG_COMPARATOR_MODE_ID == Mode) ||
 			(ANALOG_MODE_ID == Mode))
 		{
 			/* Disable alternate function */
-			CLEAR_BIT(*GPIOAFSEL[g_Port_ConfigPtr[Pin].Port_Number], g_Port_ConfigPtr[Pin].Pin_Number);
+			CLEAR_MASK(Descriptor->Regs->AFSEL, Descriptor->Mask);
 			/* Clear PMCx bits for the selected pin to use it as GPIO pin */
-			WRITE_PMCx_VALUE(g_Port_ConfigPtr[Pin].Port_Number, g_Port_ConfigPtr[Pin].Pin_Number, STD_LOW);
+			CLEAR_MASK(Descriptor->Regs->PCTL, Descriptor->Pctl_Mask);
 
 			/************************* GPIO Mode **********************************/
 			if (PORT_GPIO_MODE == Mode)
 			{
 				/* Disable analog mode */
-				CLEAR_BIT(*GPIOAMSEL[g_Port_ConfigPtr[Pin].Port_Number], g_Port_ConfigPtr[Pin].Pin_Number);
+				CLEAR_MASK(Descriptor->Regs->AMSEL, Descriptor->Mask);
 				/* Enable digital mode */
-				SET_BIT(*GPIODEN[g_Port_ConfigPtr[Pin].Port_Number], g_Port_ConfigPtr[Pin].Pin_Number);
+				SET_MASK(Descriptor->Regs->DEN, Descriptor->Mask);
 			}
 			/************************* Analog Mode **********************************/
 			else
 			{
 				/* Enable analog mode */
-				SET_BIT(*GPIOAMSEL[g_Port_ConfigPtr[Pin].Port_Number], g_Port_ConfigPtr[Pin].Pin_Number);
+				SET_MASK(Descriptor->Regs->AMSEL, Descriptor->Mask);
 				/* Disable digital mode */
-				CLEAR_BIT(*GPIODEN[g_Port_ConfigPtr[Pin].Port_Number], g_Port_ConfigPtr[Pin].Pin_Number);
+				CLEAR_MASK(Descriptor->Regs->DEN, Descriptor->Mask);
 			}
 		}
 		else /* alternate function pin */
 		{
+			/* Set PMCx bits first so the pin switches straight to the requested function */
+			WRITE_MASKED_VALUE(Descriptor->Regs->PCTL, Descriptor->Pctl_Mask,
+							   (uint32)Mode << Descriptor->Pctl_Shift);
 			/* Enable alternate function */
-			SET_BIT(*GPIOAFSEL[g_Port_ConfigPtr[Pin].Port_Number], g_Port_ConfigPtr[Pin].Pin_Number);
-			/* Set PMCx bits for the selected pin to use it as the selected alternate function */
-			WRITE_PMCx_VALUE(g_Port_ConfigPtr[Pin].Port_Number, g_Port_ConfigPtr[Pin].Pin_Number,
-							 g_Port_ConfigPtr[Pin].Pin_Mode);
+			SET_MASK(Descriptor->Regs->AFSEL, Descriptor->Mask);
 			/* Disable analog mode */
-			CLEAR_BIT(*GPIOAMSEL[g_Port_ConfigPtr[Pin].Port_Number], g_Port_ConfigPtr[Pin].Pin_Number);
+			CLEAR_MASK(Descriptor->Regs->AMSEL, Descriptor->Mask);
 			/* Enable digital mode */
-			SET_BIT(*GPIODEN[g_Port_ConfigPtr[Pin].Port_Number], g_Port_ConfigPtr[Pin].Pin_Number);
+			SET_MASK(Descriptor->Regs->DEN, Descriptor->Mask);
 		}
 	}
 	else
@@ -497,6 +541,131 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 }
 #endif /* PORT_SET_PIN_MODE_API */
 
+/************************************************************************************
+* Service Name		: Port_ApplyProfile
+* Service ID[hex]	: 0x05
+* Sync/Async		: Synchronous
+* Reentrancy		: Non Reentrant
+* Parameters (in)	: ProfileId - ID of the pin-mux profile configured in Port_Cfg.h
+* Parameters (inout): None
+* Parameters (out)	: None
+* Return value		: None
+* Description		: Function to switch all the pins of a profile to their new modes with one
+*					  masked update of DIR, AMSEL, DEN and PCTL per port, and one AFSEL
+*					  write per pin
+************************************************************************************/
+#if (STD_ON == PORT_APPLY_PROFILE_API)
+void Port_ApplyProfile(Port_ProfileIdType ProfileId)
+{
+	/* Local variable to hold the error status */
+	boolean error = FALSE;
+
+	#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Port driver is initialized before using any API */
+	if (PORT_NOT_INITIALIZED == g_Port_Status)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_APPLY_PROFILE_SID, PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* check if the input profile ID is within the valid range */
+	if (ProfileId >= PORT_CONFIGURED_PROFILES)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_APPLY_PROFILE_SID, PORT_E_PARAM_PROFILE);
+		error = TRUE;
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+
+	/* Check that every pin of the profile is configured as mode changeable */
+	if (FALSE == error)
+	{
+		const Port_ProfileType* Profile = &g_Port_ProfilesPtr[ProfileId];
+
+		for (uint8 Port = STD_LOW; Port < PORT_CONFIGURED_PORTS; Port++)
+		{
+			if (STD_LOW != (Profile->Ports[Port].Mask & ~g_Port_ImagesPtr[Port].Mode_Change))
+			{
+				error = TRUE;
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+
+		if (TRUE == error)
+		{
+			Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_APPLY_PROFILE_SID, PORT_E_MODE_UNCHANGEABLE);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+	#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error)
+	{
+		for (uint8 Port = STD_LOW; Port < PORT_CONFIGURED_PORTS; Port++)
+		{
+			const Port_ProfilePortType* Profile = &g_Port_ProfilesPtr[ProfileId].Ports[Port];
+			volatile GPIO_RegType*		Regs = GPIO_PORT(Port);
+
+			if (STD_LOW != Profile->Mask)
+			{
+				uint8 Leaving = Profile->Mask & (uint8)~Profile->Afsel;
+
+				/* Pins leaving their alternate function get their GPIO direction, then go back to GPIO
+				 * before their PMCx bits change. Pins entering one get AFSEL last, so no pin is ever
+				 * driven by a wrong peripheral. A pin is only in one of the two AFSEL writes. */
+				if (STD_LOW != Leaving)
+				{
+					WRITE_MASKED_VALUE(Regs->DIR, Leaving, Profile->Dir & Leaving);
+					CLEAR_MASK(Regs->AFSEL, Leaving);
+				}
+				else
+				{
+					/* Do Nothing ... All pins of the profile use an alternate function */
+				}
+
+				WRITE_MASKED_VALUE(Regs->PCTL, Profile->Pctl_Mask, Profile->Pctl);
+				WRITE_MASKED_VALUE(Regs->AMSEL, Profile->Mask, Profile->Amsel);
+				WRITE_MASKED_VALUE(Regs->DEN, Profile->Mask, Profile->Den);
+
+				if (STD_LOW != Profile->Afsel)
+				{
+					SET_MASK(Regs->AFSEL, Profile->Afsel);
+				}
+				else
+				{
+					/* Do Nothing ... No pin of the profile uses an alternate function */
+				}
+			}
+			else
+			{
+				/* Do Nothing ... The profile has no pins on this port */
+			}
+		}
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+#endif /* PORT_APPLY_PROFILE_API */
+
 /************************************************************************************
 *  Service name      : PORT_GetVersionInfo
 *  Syntax            : void PORT_GetVersionInfo(Std_VersionInfoType* versioninfo )
@@ -90,6 +90,12 @@
 /* Service ID for PORT set Pin mode */
 #define PORT_SET_PIN_MODE_SID			(uint8)0x04
 
+/* Service ID for PORT apply pin-mux profile */
+#define PORT_APPLY_PROFILE_SID			(uint8)0x05
+
+/* Service ID for PORT get direction drift */
+#define PORT_GET_DIRECTION_DRIFT_SID	(uint8)0x06
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -115,6 +121,12 @@
 /* Det Code to report that APIs called with a NULL Pointer*/
 #define PORT_E_PARAM_POINTER			(uint8)0x10
 
+/* DET code to report that Port_ApplyProfile service is called with an invalid profile ID */
+#define PORT_E_PARAM_PROFILE			(uint8)0x11
+
+/* DET code to report that Port_GetDirectionDrift service is called with an invalid port number */
+#define PORT_E_PARAM_PORT				(uint8)0x12
+
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -147,23 +159,99 @@ typedef enum
 	CHANGEABLE
 } Port_changeable;
 
-/* Data Structure for PIN configuration*/
+/* PIN configuration packed in 16 bits:
+ *  [2:0]   Port number				[10:7]  Mode
+ *  [5:3]   Pin number				[12:11] Internal resistor
+ *  [6]     Direction				[13]    Initial value (only for output pins)
+ *  [14]    Direction changeable	[15]    Mode changeable
+ */
+typedef uint16 Port_ConfigPins;
+
+/* Position and width of every field of Port_ConfigPins */
+#define PORT_CFG_PORT_SHIFT				(0U)
+#define PORT_CFG_PORT_MASK				(0x7U)
+#define PORT_CFG_PIN_SHIFT				(3U)
+#define PORT_CFG_PIN_MASK				(0x7U)
+#define PORT_CFG_DIRECTION_SHIFT		(6U)
+#define PORT_CFG_MODE_SHIFT				(7U)
+#define PORT_CFG_MODE_MASK				(0xFU)
+#define PORT_CFG_RESISTOR_SHIFT			(11U)
+#define PORT_CFG_RESISTOR_MASK			(0x3U)
+#define PORT_CFG_INITIAL_VALUE_SHIFT	(13U)
+#define PORT_CFG_DIRECTION_CHANGE_SHIFT (14U)
+#define PORT_CFG_MODE_CHANGE_SHIFT		(15U)
+
+/* Build a Port_ConfigPins value */
+#define PORT_CFG_ENCODE(PORT, PIN, DIR, MODE, RES, INIT, DIR_CHANGE, MODE_CHANGE)              \
+	((Port_ConfigPins)((((uint32)(PORT) & PORT_CFG_PORT_MASK) << PORT_CFG_PORT_SHIFT) |        \
+					   (((uint32)(PIN) & PORT_CFG_PIN_MASK) << PORT_CFG_PIN_SHIFT) |           \
+					   (((uint32)(DIR) & 1U) << PORT_CFG_DIRECTION_SHIFT) |                    \
+					   (((uint32)(MODE) & PORT_CFG_MODE_MASK) << PORT_CFG_MODE_SHIFT) |        \
+					   (((uint32)(RES) & PORT_CFG_RESISTOR_MASK) << PORT_CFG_RESISTOR_SHIFT) | \
+					   (((uint32)(INIT) & 1U) << PORT_CFG_INITIAL_VALUE_SHIFT) |               \
+					   (((uint32)(DIR_CHANGE) & 1U) << PORT_CFG_DIRECTION_CHANGE_SHIFT) |      \
+					   (((uint32)(MODE_CHANGE) & 1U) << PORT_CFG_MODE_CHANGE_SHIFT)))
+
+/* Read the fields of a Port_ConfigPins value */
+#define PORT_CFG_PORT(CFG)				(uint8)(((CFG) >> PORT_CFG_PORT_SHIFT) & PORT_CFG_PORT_MASK)
+#define PORT_CFG_PIN(CFG)				(Port_PinType)(((CFG) >> PORT_CFG_PIN_SHIFT) & PORT_CFG_PIN_MASK)
+#define PORT_CFG_DIRECTION(CFG)			(Port_PinDirectionType)(((CFG) >> PORT_CFG_DIRECTION_SHIFT) & 1U)
+#define PORT_CFG_MODE(CFG)				(Port_PinModeType)(((CFG) >> PORT_CFG_MODE_SHIFT) & PORT_CFG_MODE_MASK)
+#define PORT_CFG_RESISTOR(CFG) \
+	(Port_InternalResistorType)(((CFG) >> PORT_CFG_RESISTOR_SHIFT) & PORT_CFG_RESISTOR_MASK)
+#define PORT_CFG_INITIAL_VALUE(CFG)		(uint8)(((CFG) >> PORT_CFG_INITIAL_VALUE_SHIFT) & 1U)
+#define PORT_CFG_DIRECTION_CHANGE(CFG)	(boolean)(((CFG) >> PORT_CFG_DIRECTION_CHANGE_SHIFT) & 1U)
+#define PORT_CFG_MODE_CHANGE(CFG)		(boolean)(((CFG) >> PORT_CFG_MODE_CHANGE_SHIFT) & 1U)
+
+/* Register values of one port built from the pin configurations at compile time, every register
+ * is written once per port by Port_Init. Only the bits of the configured pins are written. */
+typedef struct
+{
+	uint8  Port_Number;
+	uint8  Pins_Mask; /* configured pins of the port */
+	uint8  Dir;
+	uint8  Data;   /* initial level of the output pins */
+	uint8  Pur;	   /* input pins only */
+	uint8  Pdr;	   /* input pins only */
+	uint8  Afsel;
+	uint8  Amsel;
+	uint8  Den;
+	uint8  Commit;	    /* locked pins (PD7, PF0) that need the commit register */
+	uint8  Mode_Change; /* pins whose mode may be changed at runtime */
+	uint8  Dir_Fixed;	/* pins with a fixed direction, restored by the refresh */
+	uint32 Pctl;
+	uint32 Pctl_Mask;
+} Port_PortImageType;
+
+/* Type definition for Port_ProfileIdType used by the Port_ApplyProfile API */
+typedef uint8 Port_ProfileIdType;
+
+/* Mux registers of one port for one profile, only the bits of the profile pins (Mask) are written */
 typedef struct
 {
-	uint8					  Port_Number;
-	Port_PinType			  Pin_Number;
-	Port_PinDirectionType	  Pin_Direction;
-	Port_PinModeType		  Pin_Mode;
-	Port_InternalResistorType Pin_Resistor;
-	uint8					  Pin_Initial_Value; // only for output pins
-	boolean					  Pin_Direction_Changeable;
-	boolean					  Pin_Mode_Changeable;
-} Port_ConfigPins;
+	uint8  Mask; /* pins of the port that are part of the profile, 0 if the port is not touched */
+	uint8  Dir;	 /* configured direction of the pins, used by the pins the profile gives to the GPIO */
+	uint8  Afsel;
+	uint8  Amsel;
+	uint8  Den;
+	uint32 Pctl;
+	uint32 Pctl_Mask;
+} Port_ProfilePortType;
+
+/* Pin-mux profile, indexed by port number */
+typedef struct
+{
+	Port_ProfilePortType Ports[PORT_CONFIGURED_PORTS];
+} Port_ProfileType;
 
 /* Data Structure required for initializing the Port Driver */
 typedef struct
 {
-	Port_ConfigPins Pins[PORT_CONFIGURED_PINS];
+	Port_ConfigPins	   Pins[PORT_CONFIGURED_PINS];
+	Port_PortImageType Ports[PORT_CONFIGURED_PORTS];
+#if (STD_ON == PORT_APPLY_PROFILE_API)
+	Port_ProfileType Profiles[PORT_CONFIGURED_PROFILES];
+#endif
 } Port_ConfigType;
 
 /*******************************************************************************
@@ -216,6 +304,22 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction);
 ************************************************************************************/
 void Port_RefreshPortDirection(void);
 
+/************************************************************************************
+* Service Name		: Port_GetDirectionDrift
+* Service ID[hex]	: 0x06
+* Sync/Async		: Synchronous
+* Reentrancy		: Non Reentrant
+* Parameters (in)	: PortNum - GPIO port number (PORTA to PORTF)
+* Parameters (inout): None
+* Parameters (out)	: None
+* Return value		: uint8 - pins of the port found with a wrong direction by
+*					  Port_RefreshPortDirection since the last call
+* Description		: Function to read and clear the direction drift of a port
+************************************************************************************/
+#if (STD_ON == PORT_DIRECTION_DRIFT_DETECT)
+uint8 Port_GetDirectionDrift(uint8 PortNum);
+#endif
+
 /************************************************************************************
 * Service Name		: Port_GetVersionInfo
 * Service ID[hex]	: 0x03
@@ -246,6 +350,22 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo);
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode);
 #endif
 
+/************************************************************************************
+* Service Name		: Port_ApplyProfile
+* Service ID[hex]	: 0x05
+* Sync/Async		: Synchronous
+* Reentrancy		: Non Reentrant
+* Parameters (in)	: ProfileId - ID of the pin-mux profile configured in Port_Cfg.h
+* Parameters (inout): None
+* Parameters (out)	: None
+* Return value		: None
+* Description		: Function to switch all the pins of a profile to their new modes with one
+*					  masked write per register and port
+************************************************************************************/
+#if (STD_ON == PORT_APPLY_PROFILE_API)
+void Port_ApplyProfile(Port_ProfileIdType ProfileId);
+#endif
+
 /*******************************************************************************
  *                      Definitions used in Module                             *
  *******************************************************************************/
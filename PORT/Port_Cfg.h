@@ -36,6 +36,13 @@
 /* Pre-compile option for presence of Port_SetPinMode API */
 #define PORT_SET_PIN_MODE_API			   (STD_ON)
 
+/* Pre-compile option for the direction drift check of Port_RefreshPortDirection and the
+ * presence of Port_GetDirectionDrift API */
+#define PORT_DIRECTION_DRIFT_DETECT		   (STD_ON)
+
+/* Pre-compile option for presence of Port_ApplyProfile API */
+#define PORT_APPLY_PROFILE_API			   (STD_ON)
+
 /* Configuration for The number of specified PortPins in this PortContainer */
 #define PORT_CONFIGURED_PINS			   (39U) /* PC0 to PC3 are not used (Reserved for JTAG) */
 
@@ -245,9 +252,9 @@
 #define PortConf_PE4_PIN_MODE			   (Port_PinMode) PORT_GPIO_MODE
 #define PortConf_PE5_PIN_MODE			   (Port_PinMode) PORT_GPIO_MODE
 #define PortConf_PF0_PIN_MODE			   (Port_PinMode) PORT_GPIO_MODE
-#define PortConf_PF1_PIN_MODE			   (Port_PinMode) PORT_GPIO_MODE
-#define PortConf_PF2_PIN_MODE			   (Port_PinMode) PORT_GPIO_MODE
-#define PortConf_PF3_PIN_MODE			   (Port_PinMode) PORT_GPIO_MODE
+#define PortConf_PF1_PIN_MODE			   (Port_PinMode) PORT_M1PWM5_MODE /* Red LED, PWM (Led_Cfg.h) */
+#define PortConf_PF2_PIN_MODE			   (Port_PinMode) PORT_M1PWM6_MODE /* Blue LED, PWM */
+#define PortConf_PF3_PIN_MODE			   (Port_PinMode) PORT_M1PWM7_MODE /* Green LED, PWM */
 #define PortConf_PF4_PIN_MODE			   (Port_PinMode) PORT_GPIO_MODE
 
 /* 
@@ -381,19 +388,19 @@
 #define PortConf_PF0_PIN_DIRECTION_CHANGE  (Port_changeable) NOT_CHANGEABLE
 #define PortConf_PF1_PIN_DIRECTION_CHANGE  (Port_changeable) NOT_CHANGEABLE
 #define PortConf_PF2_PIN_DIRECTION_CHANGE  (Port_changeable) NOT_CHANGEABLE
-#define PortConf_PF3_PIN_DIRECTION_CHANGE  (Port_changeable) NOT_CHANGEABLE
+#define PortConf_PF3_PIN_DIRECTION_CHANGE  (Port_changeable) CHANGEABLE
 #define PortConf_PF4_PIN_DIRECTION_CHANGE  (Port_changeable) NOT_CHANGEABLE
 
 /* 
  * PORT Configured Pin Mode changeability
  * by default all pins are changeable  
  */
-#define PortConf_PA0_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
-#define PortConf_PA1_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
-#define PortConf_PA2_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
-#define PortConf_PA3_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
-#define PortConf_PA4_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
-#define PortConf_PA5_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
+#define PortConf_PA0_PIN_MODE_CHANGE	   (Port_changeable) CHANGEABLE
+#define PortConf_PA1_PIN_MODE_CHANGE	   (Port_changeable) CHANGEABLE
+#define PortConf_PA2_PIN_MODE_CHANGE	   (Port_changeable) CHANGEABLE
+#define PortConf_PA3_PIN_MODE_CHANGE	   (Port_changeable) CHANGEABLE
+#define PortConf_PA4_PIN_MODE_CHANGE	   (Port_changeable) CHANGEABLE
+#define PortConf_PA5_PIN_MODE_CHANGE	   (Port_changeable) CHANGEABLE
 #define PortConf_PA6_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
 #define PortConf_PA7_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
 #define PortConf_PB0_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
@@ -425,7 +432,40 @@
 #define PortConf_PF0_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
 #define PortConf_PF1_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
 #define PortConf_PF2_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
-#define PortConf_PF3_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
+#define PortConf_PF3_PIN_MODE_CHANGE	   (Port_changeable) CHANGEABLE
 #define PortConf_PF4_PIN_MODE_CHANGE	   (Port_changeable) NOT_CHANGEABLE
 
+/* Number of GPIO ports that get a register image in Port_PBcfg.c (PORTA to PORTF) */
+#define PORT_CONFIGURED_PORTS			   (6U)
+
+/* Configured pins of every port, used to build the per-port register images in Port_PBcfg.c */
+#define PORT_PORTA_PINS(PIN)			   PIN(PA0) PIN(PA1) PIN(PA2) PIN(PA3) PIN(PA4) PIN(PA5) PIN(PA6) PIN(PA7)
+#define PORT_PORTB_PINS(PIN)			   PIN(PB0) PIN(PB1) PIN(PB2) PIN(PB3) PIN(PB4) PIN(PB5) PIN(PB6) PIN(PB7)
+#define PORT_PORTC_PINS(PIN)			   PIN(PC4) PIN(PC5) PIN(PC6) PIN(PC7) /* PC0 to PC3 are JTAG */
+#define PORT_PORTD_PINS(PIN)			   PIN(PD0) PIN(PD1) PIN(PD2) PIN(PD3) PIN(PD4) PIN(PD5) PIN(PD6) PIN(PD7)
+#define PORT_PORTE_PINS(PIN)			   PIN(PE0) PIN(PE1) PIN(PE2) PIN(PE3) PIN(PE4) PIN(PE5)
+#define PORT_PORTF_PINS(PIN)			   PIN(PF0) PIN(PF1) PIN(PF2) PIN(PF3) PIN(PF4)
+
+/* Number of pin-mux profiles that can be applied with Port_ApplyProfile */
+#define PORT_CONFIGURED_PROFILES		   (4U)
+
+/* Profile Index in the profiles array in Port_PBcfg.c */
+#define PortConf_UART0_ACTIVE_PROFILE_ID   (Port_ProfileIdType)0 /* PA0/PA1 driven by UART0 */
+#define PortConf_UART0_SLEEP_PROFILE_ID	   (Port_ProfileIdType)1 /* PA0/PA1 back to GPIO */
+#define PortConf_SSI0_ACTIVE_PROFILE_ID	   (Port_ProfileIdType)2 /* PA2 to PA5 driven by SSI0 */
+#define PortConf_SSI0_RECOVERY_PROFILE_ID  (Port_ProfileIdType)3 /* PA2 to PA5 as GPIO for bit-banging */
+
+/* Pins of every profile with their new mode, listed as PIN(ARG, <pin>, <mode>). The pins must be
+ * configured with PIN_MODE_CHANGE = CHANGEABLE, the other pins of the port are left as they are. */
+#define PortConf_UART0_ACTIVE_PROFILE(PIN, ARG) \
+	PIN(ARG, PA0, PORT_U0RX_MODE) PIN(ARG, PA1, PORT_U0TX_MODE)
+#define PortConf_UART0_SLEEP_PROFILE(PIN, ARG) \
+	PIN(ARG, PA0, PORT_GPIO_MODE) PIN(ARG, PA1, PORT_GPIO_MODE)
+#define PortConf_SSI0_ACTIVE_PROFILE(PIN, ARG)                                                        \
+	PIN(ARG, PA2, PORT_SSI0CLK_MODE) PIN(ARG, PA3, PORT_SSI0FSS_MODE) PIN(ARG, PA4, PORT_SSI0RX_MODE) \
+		PIN(ARG, PA5, PORT_SSI0TX_MODE)
+#define PortConf_SSI0_RECOVERY_PROFILE(PIN, ARG)                                              \
+	PIN(ARG, PA2, PORT_GPIO_MODE) PIN(ARG, PA3, PORT_GPIO_MODE) PIN(ARG, PA4, PORT_GPIO_MODE) \
+		PIN(ARG, PA5, PORT_GPIO_MODE)
+
 #endif /* PORT_CFG_H */
\ No newline at end of file
@@ -36,6 +36,117 @@
 	#error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
+/************************************************************************************
+ * Helpers building the per-port register images from the pin configurations above,
+ * every macro expands to "| <bit of the pin in the register>" for one pin
+ ************************************************************************************/
+#define PORT_IS_ANALOG_MODE(MODE) \
+	((ADC_MODE_ID == (MODE)) || (ANALOG_COMPARATOR_MODE_ID == (MODE)) || (ANALOG_MODE_ID == (MODE)))
+#define PORT_IS_ALTERNATE_MODE(MODE) ((PORT_GPIO_MODE != (MODE)) && !PORT_IS_ANALOG_MODE(MODE))
+
+#define PORT_PIN_BIT(P)				 BIT(PortConf_##P##_PIN_NUM)
+#define PORT_PIN_IF(P, CONDITION)	 ((CONDITION) ? PORT_PIN_BIT(P) : 0U)
+#define PORT_PIN_IS_OUT(P)			 (PORT_PIN_OUT == PortConf_##P##_PIN_DIRECTION)
+#define PORT_PIN_IS_HIGH(P)			 (STD_HIGH == PortConf_##P##_PIN_INITIAL_VALUE)
+#define PORT_PIN_RESISTOR(P)		 PortConf_##P##_PIN_INTERNAL_RESISTOR
+#define PORT_PIN_IS_ANALOG(P)		 PORT_IS_ANALOG_MODE(PortConf_##P##_PIN_MODE)
+#define PORT_PIN_IS_ALTERNATE(P)	 PORT_IS_ALTERNATE_MODE(PortConf_##P##_PIN_MODE)
+
+#define PORT_IMAGE_MASK(P)			 | PORT_PIN_BIT(P)
+#define PORT_IMAGE_DIR(P)			 | PORT_PIN_IF(P, PORT_PIN_IS_OUT(P))
+#define PORT_IMAGE_DATA(P)			 | PORT_PIN_IF(P, PORT_PIN_IS_OUT(P) && PORT_PIN_IS_HIGH(P))
+#define PORT_IMAGE_PUR(P)			 | PORT_PIN_IF(P, !PORT_PIN_IS_OUT(P) && (PULL_UP == PORT_PIN_RESISTOR(P)))
+#define PORT_IMAGE_PDR(P)			 | PORT_PIN_IF(P, !PORT_PIN_IS_OUT(P) && (PULL_DOWN == PORT_PIN_RESISTOR(P)))
+#define PORT_IMAGE_AFSEL(P)			 | PORT_PIN_IF(P, PORT_PIN_IS_ALTERNATE(P))
+#define PORT_IMAGE_AMSEL(P)			 | PORT_PIN_IF(P, PORT_PIN_IS_ANALOG(P))
+#define PORT_IMAGE_DEN(P)			 | PORT_PIN_IF(P, !PORT_PIN_IS_ANALOG(P))
+
+/* PD7 and PF0 are locked after reset (NMI and JTAG sensitive pins) */
+#define PORT_IMAGE_COMMIT(P)                                                                \
+	| PORT_PIN_IF(P, ((3U == PortConf_##P##_PORT_NUM) && (7U == PortConf_##P##_PIN_NUM)) || \
+						 ((5U == PortConf_##P##_PORT_NUM) && (0U == PortConf_##P##_PIN_NUM)))
+
+#define PORT_IMAGE_MODE_CHANGE(P)	 | PORT_PIN_IF(P, CHANGEABLE == PortConf_##P##_PIN_MODE_CHANGE)
+#define PORT_IMAGE_DIR_FIXED(P)		 | PORT_PIN_IF(P, NOT_CHANGEABLE == PortConf_##P##_PIN_DIRECTION_CHANGE)
+
+/* PMCx nibble of the pin, only alternate functions have a non zero value */
+#define PORT_PIN_PCTL_SHIFT(P)		 (4U * PortConf_##P##_PIN_NUM)
+#define PORT_IMAGE_PCTL(P) \
+	| (PORT_PIN_IS_ALTERNATE(P) ? ((uint32)PortConf_##P##_PIN_MODE << PORT_PIN_PCTL_SHIFT(P)) : 0U)
+#define PORT_IMAGE_PCTL_MASK(P)		 | ((uint32)0x0000000F << PORT_PIN_PCTL_SHIFT(P))
+
+/* Packed configuration of one pin */
+#define PORT_PIN_CONFIG(P)                                                                         \
+	PORT_CFG_ENCODE(PortConf_##P##_PORT_NUM, PortConf_##P##_PIN_NUM, PortConf_##P##_PIN_DIRECTION, \
+					PortConf_##P##_PIN_MODE, PortConf_##P##_PIN_INTERNAL_RESISTOR,                 \
+					PortConf_##P##_PIN_INITIAL_VALUE, PortConf_##P##_PIN_DIRECTION_CHANGE,         \
+					PortConf_##P##_PIN_MODE_CHANGE)
+
+/* Register image of the port PORT_ID whose pins are listed by the X-macro PINS */
+#define PORT_IMAGE(PORT_ID, PINS)                                \
+	{                                                            \
+		.Port_Number = (PORT_ID),                                \
+		.Pins_Mask = (uint8)(0U PINS(PORT_IMAGE_MASK)),          \
+		.Dir = (uint8)(0U PINS(PORT_IMAGE_DIR)),                 \
+		.Data = (uint8)(0U PINS(PORT_IMAGE_DATA)),               \
+		.Pur = (uint8)(0U PINS(PORT_IMAGE_PUR)),                 \
+		.Pdr = (uint8)(0U PINS(PORT_IMAGE_PDR)),                 \
+		.Afsel = (uint8)(0U PINS(PORT_IMAGE_AFSEL)),             \
+		.Amsel = (uint8)(0U PINS(PORT_IMAGE_AMSEL)),             \
+		.Den = (uint8)(0U PINS(PORT_IMAGE_DEN)),                 \
+		.Commit = (uint8)(0U PINS(PORT_IMAGE_COMMIT)),           \
+		.Mode_Change = (uint8)(0U PINS(PORT_IMAGE_MODE_CHANGE)), \
+		.Dir_Fixed = (uint8)(0U PINS(PORT_IMAGE_DIR_FIXED)),     \
+		.Pctl = (0U PINS(PORT_IMAGE_PCTL)),                      \
+		.Pctl_Mask = (0U PINS(PORT_IMAGE_PCTL_MASK)),            \
+	}
+
+#if (STD_ON == PORT_APPLY_PROFILE_API)
+/************************************************************************************
+ * Helpers building the pin-mux profiles, every macro expands to "| <bit of the pin>"
+ * when the profile pin P belongs to the port PORT_ID and 0 otherwise
+ ************************************************************************************/
+#define PORT_PROFILE_PIN_IF(PORT_ID, P, CONDITION) \
+	((((PORT_ID) == PortConf_##P##_PORT_NUM) && (CONDITION)) ? PORT_PIN_BIT(P) : 0U)
+
+#define PORT_PROFILE_MASK(PORT_ID, P, MODE)	 | PORT_PROFILE_PIN_IF(PORT_ID, P, TRUE)
+#define PORT_PROFILE_DIR(PORT_ID, P, MODE)	 | PORT_PROFILE_PIN_IF(PORT_ID, P, PORT_PIN_IS_OUT(P))
+#define PORT_PROFILE_AFSEL(PORT_ID, P, MODE) | PORT_PROFILE_PIN_IF(PORT_ID, P, PORT_IS_ALTERNATE_MODE(MODE))
+#define PORT_PROFILE_AMSEL(PORT_ID, P, MODE) | PORT_PROFILE_PIN_IF(PORT_ID, P, PORT_IS_ANALOG_MODE(MODE))
+#define PORT_PROFILE_DEN(PORT_ID, P, MODE)	 | PORT_PROFILE_PIN_IF(PORT_ID, P, !PORT_IS_ANALOG_MODE(MODE))
+#define PORT_PROFILE_PCTL(PORT_ID, P, MODE)                                     \
+	| ((((PORT_ID) == PortConf_##P##_PORT_NUM) && PORT_IS_ALTERNATE_MODE(MODE)) \
+		   ? ((uint32)(MODE) << PORT_PIN_PCTL_SHIFT(P))                         \
+		   : 0U)
+#define PORT_PROFILE_PCTL_MASK(PORT_ID, P, MODE) \
+	| (((PORT_ID) == PortConf_##P##_PORT_NUM) ? ((uint32)0x0000000F << PORT_PIN_PCTL_SHIFT(P)) : 0U)
+
+/* Mux registers of the port PORT_ID for the profile whose pins are listed by the X-macro PINS */
+#define PORT_PROFILE_PORT(PORT_ID, PINS)                         \
+	{                                                            \
+		.Mask = (uint8)(0U PINS(PORT_PROFILE_MASK, PORT_ID)),    \
+		.Dir = (uint8)(0U PINS(PORT_PROFILE_DIR, PORT_ID)),      \
+		.Afsel = (uint8)(0U PINS(PORT_PROFILE_AFSEL, PORT_ID)),  \
+		.Amsel = (uint8)(0U PINS(PORT_PROFILE_AMSEL, PORT_ID)),  \
+		.Den = (uint8)(0U PINS(PORT_PROFILE_DEN, PORT_ID)),      \
+		.Pctl = (0U PINS(PORT_PROFILE_PCTL, PORT_ID)),           \
+		.Pctl_Mask = (0U PINS(PORT_PROFILE_PCTL_MASK, PORT_ID)), \
+	}
+
+/* Pin-mux profile whose pins are listed by the X-macro PINS */
+#define PORT_PROFILE(PINS)                     \
+	{                                          \
+		.Ports = {                             \
+			[0] = PORT_PROFILE_PORT(0U, PINS), \
+			[1] = PORT_PROFILE_PORT(1U, PINS), \
+			[2] = PORT_PROFILE_PORT(2U, PINS), \
+			[3] = PORT_PROFILE_PORT(3U, PINS), \
+			[4] = PORT_PROFILE_PORT(4U, PINS), \
+			[5] = PORT_PROFILE_PORT(5U, PINS), \
+		},                                     \
+	}
+#endif /* PORT_APPLY_PROFILE_API */
+
 /* PB structure used with Port_Init API */
 const Port_ConfigType Port_Configuration = {
 	.Pins =
@@ -43,450 +154,90 @@ const Port_ConfigType Port_Configuration = {
 			/********************************************************
 			 * 							PORTA 						*
 			 ********************************************************/
-			[PortConf_PA0_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PA0_PORT_NUM,
-					.Pin_Number = PortConf_PA0_PIN_NUM,
-					.Pin_Direction = PortConf_PA0_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PA0_PIN_MODE,
-					.Pin_Resistor = PortConf_PA0_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PA0_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PA0_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PA0_PIN_MODE_CHANGE,
-				},
-			[PortConf_PA1_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PA1_PORT_NUM,
-					.Pin_Number = PortConf_PA1_PIN_NUM,
-					.Pin_Direction = PortConf_PA1_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PA1_PIN_MODE,
-					.Pin_Resistor = PortConf_PA1_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PA1_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PA1_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PA1_PIN_MODE_CHANGE,
-				},
-			[PortConf_PA2_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PA2_PORT_NUM,
-					.Pin_Number = PortConf_PA2_PIN_NUM,
-					.Pin_Direction = PortConf_PA2_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PA2_PIN_MODE,
-					.Pin_Resistor = PortConf_PA2_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PA2_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PA2_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PA2_PIN_MODE_CHANGE,
-				},
-			[PortConf_PA3_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PA3_PORT_NUM,
-					.Pin_Number = PortConf_PA3_PIN_NUM,
-					.Pin_Direction = PortConf_PA3_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PA3_PIN_MODE,
-					.Pin_Resistor = PortConf_PA3_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PA3_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PA3_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PA3_PIN_MODE_CHANGE,
-				},
-			[PortConf_PA4_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PA4_PORT_NUM,
-					.Pin_Number = PortConf_PA4_PIN_NUM,
-					.Pin_Direction = PortConf_PA4_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PA4_PIN_MODE,
-					.Pin_Resistor = PortConf_PA4_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PA4_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PA4_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PA4_PIN_MODE_CHANGE,
-				},
-			[PortConf_PA5_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PA5_PORT_NUM,
-					.Pin_Number = PortConf_PA5_PIN_NUM,
-					.Pin_Direction = PortConf_PA5_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PA5_PIN_MODE,
-					.Pin_Resistor = PortConf_PA5_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PA5_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PA5_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PA5_PIN_MODE_CHANGE,
-				},
-			[PortConf_PA6_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PA6_PORT_NUM,
-					.Pin_Number = PortConf_PA6_PIN_NUM,
-					.Pin_Direction = PortConf_PA6_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PA6_PIN_MODE,
-					.Pin_Resistor = PortConf_PA6_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PA6_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PA6_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PA6_PIN_MODE_CHANGE,
-				},
-			[PortConf_PA7_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PA7_PORT_NUM,
-					.Pin_Number = PortConf_PA7_PIN_NUM,
-					.Pin_Direction = PortConf_PA7_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PA7_PIN_MODE,
-					.Pin_Resistor = PortConf_PA7_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PA7_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PA7_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PA7_PIN_MODE_CHANGE,
-				},
+			[PortConf_PA0_PIN_ID_INDEX] = PORT_PIN_CONFIG(PA0),
+			[PortConf_PA1_PIN_ID_INDEX] = PORT_PIN_CONFIG(PA1),
+			[PortConf_PA2_PIN_ID_INDEX] = PORT_PIN_CONFIG(PA2),
+			[PortConf_PA3_PIN_ID_INDEX] = PORT_PIN_CONFIG(PA3),
+			[PortConf_PA4_PIN_ID_INDEX] = PORT_PIN_CONFIG(PA4),
+			[PortConf_PA5_PIN_ID_INDEX] = PORT_PIN_CONFIG(PA5),
+			[PortConf_PA6_PIN_ID_INDEX] = PORT_PIN_CONFIG(PA6),
+			[PortConf_PA7_PIN_ID_INDEX] = PORT_PIN_CONFIG(PA7),
+
 			/********************************************************
 			 * 							PORTB 						*
 			 ********************************************************/
-			[PortConf_PB0_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PB0_PORT_NUM,
-					.Pin_Number = PortConf_PB0_PIN_NUM,
-					.Pin_Direction = PortConf_PB0_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PB0_PIN_MODE,
-					.Pin_Resistor = PortConf_PB0_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PB0_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PB0_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PB0_PIN_MODE_CHANGE,
-				},
-			[PortConf_PB1_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PB1_PORT_NUM,
-					.Pin_Number = PortConf_PB1_PIN_NUM,
-					.Pin_Direction = PortConf_PB1_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PB1_PIN_MODE,
-					.Pin_Resistor = PortConf_PB1_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PB1_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PB1_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PB1_PIN_MODE_CHANGE,
-				},
-			[PortConf_PB2_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PB2_PORT_NUM,
-					.Pin_Number = PortConf_PB2_PIN_NUM,
-					.Pin_Direction = PortConf_PB2_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PB2_PIN_MODE,
-					.Pin_Resistor = PortConf_PB2_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PB2_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PB2_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PB2_PIN_MODE_CHANGE,
-				},
-			[PortConf_PB3_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PB3_PORT_NUM,
-					.Pin_Number = PortConf_PB3_PIN_NUM,
-					.Pin_Direction = PortConf_PB3_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PB3_PIN_MODE,
-					.Pin_Resistor = PortConf_PB3_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PB3_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PB3_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PB3_PIN_MODE_CHANGE,
-				},
-			[PortConf_PB4_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PB4_PORT_NUM,
-					.Pin_Number = PortConf_PB4_PIN_NUM,
-					.Pin_Direction = PortConf_PB4_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PB4_PIN_MODE,
-					.Pin_Resistor = PortConf_PB4_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PB4_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PB4_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PB4_PIN_MODE_CHANGE,
-				},
-			[PortConf_PB5_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PB5_PORT_NUM,
-					.Pin_Number = PortConf_PB5_PIN_NUM,
-					.Pin_Direction = PortConf_PB5_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PB5_PIN_MODE,
-					.Pin_Resistor = PortConf_PB5_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PB5_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PB5_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PB5_PIN_MODE_CHANGE,
-				},
-			[PortConf_PB6_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PB6_PORT_NUM,
-					.Pin_Number = PortConf_PB6_PIN_NUM,
-					.Pin_Direction = PortConf_PB6_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PB6_PIN_MODE,
-					.Pin_Resistor = PortConf_PB6_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PB6_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PB6_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PB6_PIN_MODE_CHANGE,
-				},
-			[PortConf_PB7_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PB7_PORT_NUM,
-					.Pin_Number = PortConf_PB7_PIN_NUM,
-					.Pin_Direction = PortConf_PB7_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PB7_PIN_MODE,
-					.Pin_Resistor = PortConf_PB7_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PB7_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PB7_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PB7_PIN_MODE_CHANGE,
-				},
+			[PortConf_PB0_PIN_ID_INDEX] = PORT_PIN_CONFIG(PB0),
+			[PortConf_PB1_PIN_ID_INDEX] = PORT_PIN_CONFIG(PB1),
+			[PortConf_PB2_PIN_ID_INDEX] = PORT_PIN_CONFIG(PB2),
+			[PortConf_PB3_PIN_ID_INDEX] = PORT_PIN_CONFIG(PB3),
+			[PortConf_PB4_PIN_ID_INDEX] = PORT_PIN_CONFIG(PB4),
+			[PortConf_PB5_PIN_ID_INDEX] = PORT_PIN_CONFIG(PB5),
+			[PortConf_PB6_PIN_ID_INDEX] = PORT_PIN_CONFIG(PB6),
+			[PortConf_PB7_PIN_ID_INDEX] = PORT_PIN_CONFIG(PB7),
+
 			/********************************************************
 			 * 							PORTC 						*
 			 ********************************************************/
-			[PortConf_PC4_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PC4_PORT_NUM,
-					.Pin_Number = PortConf_PC4_PIN_NUM,
-					.Pin_Direction = PortConf_PC4_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PC4_PIN_MODE,
-					.Pin_Resistor = PortConf_PC4_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PC4_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PC4_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PC4_PIN_MODE_CHANGE,
-				},
-			[PortConf_PC5_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PC5_PORT_NUM,
-					.Pin_Number = PortConf_PC5_PIN_NUM,
-					.Pin_Direction = PortConf_PC5_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PC5_PIN_MODE,
-					.Pin_Resistor = PortConf_PC5_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PC5_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PC5_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PC5_PIN_MODE_CHANGE,
-				},
-			[PortConf_PC6_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PC6_PORT_NUM,
-					.Pin_Number = PortConf_PC6_PIN_NUM,
-					.Pin_Direction = PortConf_PC6_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PC6_PIN_MODE,
-					.Pin_Resistor = PortConf_PC6_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PC6_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PC6_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PC6_PIN_MODE_CHANGE,
-				},
-			[PortConf_PC7_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PC7_PORT_NUM,
-					.Pin_Number = PortConf_PC7_PIN_NUM,
-					.Pin_Direction = PortConf_PC7_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PC7_PIN_MODE,
-					.Pin_Resistor = PortConf_PC7_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PC7_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PC7_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PC7_PIN_MODE_CHANGE,
-				},
+			[PortConf_PC4_PIN_ID_INDEX] = PORT_PIN_CONFIG(PC4),
+			[PortConf_PC5_PIN_ID_INDEX] = PORT_PIN_CONFIG(PC5),
+			[PortConf_PC6_PIN_ID_INDEX] = PORT_PIN_CONFIG(PC6),
+			[PortConf_PC7_PIN_ID_INDEX] = PORT_PIN_CONFIG(PC7),
+
 			/********************************************************
 			 * 							PORTD 						*
 			 ********************************************************/
-			[PortConf_PD0_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PD0_PORT_NUM,
-					.Pin_Number = PortConf_PD0_PIN_NUM,
-					.Pin_Direction = PortConf_PD0_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PD0_PIN_MODE,
-					.Pin_Resistor = PortConf_PD0_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PD0_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PD0_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PD0_PIN_MODE_CHANGE,
-				},
-			[PortConf_PD1_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PD1_PORT_NUM,
-					.Pin_Number = PortConf_PD1_PIN_NUM,
-					.Pin_Direction = PortConf_PD1_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PD1_PIN_MODE,
-					.Pin_Resistor = PortConf_PD1_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PD1_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PD1_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PD1_PIN_MODE_CHANGE,
-				},
-			[PortConf_PD2_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PD2_PORT_NUM,
-					.Pin_Number = PortConf_PD2_PIN_NUM,
-					.Pin_Direction = PortConf_PD2_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PD2_PIN_MODE,
-					.Pin_Resistor = PortConf_PD2_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PD2_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PD2_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PD2_PIN_MODE_CHANGE,
-				},
-			[PortConf_PD3_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PD3_PORT_NUM,
-					.Pin_Number = PortConf_PD3_PIN_NUM,
-					.Pin_Direction = PortConf_PD3_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PD3_PIN_MODE,
-					.Pin_Resistor = PortConf_PD3_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PD3_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PD3_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PD3_PIN_MODE_CHANGE,
-				},
-			[PortConf_PD4_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PD4_PORT_NUM,
-					.Pin_Number = PortConf_PD4_PIN_NUM,
-					.Pin_Direction = PortConf_PD4_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PD4_PIN_MODE,
-					.Pin_Resistor = PortConf_PD4_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PD4_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PD4_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PD4_PIN_MODE_CHANGE,
-				},
-			[PortConf_PD5_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PD5_PORT_NUM,
-					.Pin_Number = PortConf_PD5_PIN_NUM,
-					.Pin_Direction = PortConf_PD5_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PD5_PIN_MODE,
-					.Pin_Resistor = PortConf_PD5_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PD5_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PD5_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PD5_PIN_MODE_CHANGE,
-				},
-			[PortConf_PD6_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PD6_PORT_NUM,
-					.Pin_Number = PortConf_PD6_PIN_NUM,
-					.Pin_Direction = PortConf_PD6_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PD6_PIN_MODE,
-					.Pin_Resistor = PortConf_PD6_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PD6_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PD6_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PD6_PIN_MODE_CHANGE,
-				},
-			[PortConf_PD7_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PD7_PORT_NUM,
-					.Pin_Number = PortConf_PD7_PIN_NUM,
-					.Pin_Direction = PortConf_PD7_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PD7_PIN_MODE,
-					.Pin_Resistor = PortConf_PD7_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PD7_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PD7_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PD7_PIN_MODE_CHANGE,
-				},
+			[PortConf_PD0_PIN_ID_INDEX] = PORT_PIN_CONFIG(PD0),
+			[PortConf_PD1_PIN_ID_INDEX] = PORT_PIN_CONFIG(PD1),
+			[PortConf_PD2_PIN_ID_INDEX] = PORT_PIN_CONFIG(PD2),
+			[PortConf_PD3_PIN_ID_INDEX] = PORT_PIN_CONFIG(PD3),
+			[PortConf_PD4_PIN_ID_INDEX] = PORT_PIN_CONFIG(PD4),
+			[PortConf_PD5_PIN_ID_INDEX] = PORT_PIN_CONFIG(PD5),
+			[PortConf_PD6_PIN_ID_INDEX] = PORT_PIN_CONFIG(PD6),
+			[PortConf_PD7_PIN_ID_INDEX] = PORT_PIN_CONFIG(PD7),
+
 			/********************************************************
-			 * 							PORTF 						*
+			 * 							PORTE 						*
 			 ********************************************************/
-			[PortConf_PE0_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PE0_PORT_NUM,
-					.Pin_Number = PortConf_PE0_PIN_NUM,
-					.Pin_Direction = PortConf_PE0_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PE0_PIN_MODE,
-					.Pin_Resistor = PortConf_PE0_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PE0_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PE0_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PE0_PIN_MODE_CHANGE,
-				},
-			[PortConf_PE1_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PE1_PORT_NUM,
-					.Pin_Number = PortConf_PE1_PIN_NUM,
-					.Pin_Direction = PortConf_PE1_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PE1_PIN_MODE,
-					.Pin_Resistor = PortConf_PE1_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PE1_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PE1_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PE1_PIN_MODE_CHANGE,
-				},
-			[PortConf_PE2_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PE2_PORT_NUM,
-					.Pin_Number = PortConf_PE2_PIN_NUM,
-					.Pin_Direction = PortConf_PE2_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PE2_PIN_MODE,
-					.Pin_Resistor = PortConf_PE2_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PE2_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PE2_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PE2_PIN_MODE_CHANGE,
-				},
-			[PortConf_PE3_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PE3_PORT_NUM,
-					.Pin_Number = PortConf_PE3_PIN_NUM,
-					.Pin_Direction = PortConf_PE3_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PE3_PIN_MODE,
-					.Pin_Resistor = PortConf_PE3_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PE3_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PE3_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PE3_PIN_MODE_CHANGE,
-				},
-			[PortConf_PE4_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PE4_PORT_NUM,
-					.Pin_Number = PortConf_PE4_PIN_NUM,
-					.Pin_Direction = PortConf_PE4_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PE4_PIN_MODE,
-					.Pin_Resistor = PortConf_PE4_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PE4_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PE4_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PE4_PIN_MODE_CHANGE,
-				},
-			[PortConf_PE5_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PE5_PORT_NUM,
-					.Pin_Number = PortConf_PE5_PIN_NUM,
-					.Pin_Direction = PortConf_PE5_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PE5_PIN_MODE,
-					.Pin_Resistor = PortConf_PE5_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PE5_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PE5_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PE5_PIN_MODE_CHANGE,
-				},
+			[PortConf_PE0_PIN_ID_INDEX] = PORT_PIN_CONFIG(PE0),
+			[PortConf_PE1_PIN_ID_INDEX] = PORT_PIN_CONFIG(PE1),
+			[PortConf_PE2_PIN_ID_INDEX] = PORT_PIN_CONFIG(PE2),
+			[PortConf_PE3_PIN_ID_INDEX] = PORT_PIN_CONFIG(PE3),
+			[PortConf_PE4_PIN_ID_INDEX] = PORT_PIN_CONFIG(PE4),
+			[PortConf_PE5_PIN_ID_INDEX] = PORT_PIN_CONFIG(PE5),
+
 			/********************************************************
 			 * 							PORTF 						*
 			 ********************************************************/
-			[PortConf_PF0_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PF0_PORT_NUM,
-					.Pin_Number = PortConf_PF0_PIN_NUM,
-					.Pin_Direction = PortConf_PF0_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PF0_PIN_MODE,
-					.Pin_Resistor = PortConf_PF0_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PF0_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PF0_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PF0_PIN_MODE_CHANGE,
-				},
-			[PortConf_PF1_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PF1_PORT_NUM,
-					.Pin_Number = PortConf_PF1_PIN_NUM,
-					.Pin_Direction = PortConf_PF1_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PF1_PIN_MODE,
-					.Pin_Resistor = PortConf_PF1_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PF1_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PF1_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PF1_PIN_MODE_CHANGE,
-				},
-			[PortConf_PF2_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PF2_PORT_NUM,
-					.Pin_Number = PortConf_PF2_PIN_NUM,
-					.Pin_Direction = PortConf_PF2_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PF2_PIN_MODE,
-					.Pin_Resistor = PortConf_PF2_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PF2_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PF2_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PF2_PIN_MODE_CHANGE,
-				},
-			[PortConf_PF3_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PF3_PORT_NUM,
-					.Pin_Number = PortConf_PF3_PIN_NUM,
-					.Pin_Direction = PortConf_PF3_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PF3_PIN_MODE,
-					.Pin_Resistor = PortConf_PF3_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PF3_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PF3_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PF3_PIN_MODE_CHANGE,
-				},
-			[PortConf_PF4_PIN_ID_INDEX] =
-				{
-					.Port_Number = PortConf_PF4_PORT_NUM,
-					.Pin_Number = PortConf_PF4_PIN_NUM,
-					.Pin_Direction = PortConf_PF4_PIN_DIRECTION,
-					.Pin_Mode = PortConf_PF4_PIN_MODE,
-					.Pin_Resistor = PortConf_PF4_PIN_INTERNAL_RESISTOR,
-					.Pin_Initial_Value = PortConf_PF4_PIN_INITIAL_VALUE,
-					.Pin_Direction_Changeable = PortConf_PF4_PIN_DIRECTION_CHANGE,
-					.Pin_Mode_Changeable = PortConf_PF4_PIN_MODE_CHANGE,
-				},
+			[PortConf_PF0_PIN_ID_INDEX] = PORT_PIN_CONFIG(PF0),
+			[PortConf_PF1_PIN_ID_INDEX] = PORT_PIN_CONFIG(PF1),
+			[PortConf_PF2_PIN_ID_INDEX] = PORT_PIN_CONFIG(PF2),
+			[PortConf_PF3_PIN_ID_INDEX] = PORT_PIN_CONFIG(PF3),
+			[PortConf_PF4_PIN_ID_INDEX] = PORT_PIN_CONFIG(PF4),
+		},
+
+	/********************************************************
+	 * 			Register images written by Port_Init 		*
+	 ********************************************************/
+	.Ports =
+		{
+			[0] = PORT_IMAGE(0U, PORT_PORTA_PINS),
+			[1] = PORT_IMAGE(1U, PORT_PORTB_PINS),
+			[2] = PORT_IMAGE(2U, PORT_PORTC_PINS),
+			[3] = PORT_IMAGE(3U, PORT_PORTD_PINS),
+			[4] = PORT_IMAGE(4U, PORT_PORTE_PINS),
+			[5] = PORT_IMAGE(5U, PORT_PORTF_PINS),
+		},
 
+#if (STD_ON == PORT_APPLY_PROFILE_API)
+	/********************************************************
+	 * 		Pin-mux profiles applied by Port_ApplyProfile 	*
+	 ********************************************************/
+	.Profiles =
+		{
+			[PortConf_UART0_ACTIVE_PROFILE_ID] = PORT_PROFILE(PortConf_UART0_ACTIVE_PROFILE),
+			[PortConf_UART0_SLEEP_PROFILE_ID] = PORT_PROFILE(PortConf_UART0_SLEEP_PROFILE),
+			[PortConf_SSI0_ACTIVE_PROFILE_ID] = PORT_PROFILE(PortConf_SSI0_ACTIVE_PROFILE),
+			[PortConf_SSI0_RECOVERY_PROFILE_ID] = PORT_PROFILE(PortConf_SSI0_RECOVERY_PROFILE),
 		},
-};
\ No newline at end of file
+#endif
+};
@@ -0,0 +1,443 @@
+/******************************************************************
+ * @Module   	: Pwm
+ * @Title 	 	: PWM Module Source file
+ * @Filename 	: Pwm.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	: The generator drives the output to the active level when it loads
+ *                the period and to the inactive level at the compare value, the
+ *                polarity is applied by the output inversion register.
+ ********************************************************************/
+
+#include "Pwm.h"
+#include "Peripheral_Regs.h"
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+
+	#include "Det.h"
+
+	/* AUTOSAR Version checking between Det and Pwm Modules */
+	#if ((DET_AR_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION) || \
+		 (DET_AR_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION) || \
+		 (DET_AR_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+		#error "The AR version of Det.h does not match the expected version"
+	#endif
+
+#endif
+
+/* Number of PWM modules and of generators in a module */
+#define PWM_NUMBER_OF_MODULES	   (2U)
+#define PWM_NUMBER_OF_GENERATORS   (4U)
+
+/* PWMnCTL: generator enabled, compare and generator action updates at the end of the period
+ * (locally synchronized) or at the end of the period after a PWMCTL GLOBALSYNC request (globally
+ * synchronized). The load register stays locally synchronized. */
+#define PWM_GEN_CTL_ENABLE		   (0x00000001U)
+#define PWM_GEN_CTL_CMPAUPD_GLOBAL (0x00000010U)
+#define PWM_GEN_CTL_CMPBUPD_GLOBAL (0x00000020U)
+#define PWM_GEN_CTL_GENAUPD_LOCAL  (0x00000080U)
+#define PWM_GEN_CTL_GENAUPD_GLOBAL (0x000000C0U)
+#define PWM_GEN_CTL_GENBUPD_LOCAL  (0x00000200U)
+#define PWM_GEN_CTL_GENBUPD_GLOBAL (0x00000300U)
+
+/* PWMnGENA/PWMnGENB actions: drive the output high or low when the counter loads the period,
+ * drive it low when the counter matches the compare value of the output while counting down */
+#define PWM_GEN_ACT_LOAD_HIGH	   (0x0000000CU)
+#define PWM_GEN_ACT_LOAD_LOW	   (0x00000008U)
+#define PWM_GEN_ACT_CMPAD_LOW	   (0x00000080U)
+#define PWM_GEN_ACT_CMPBD_LOW	   (0x00000800U)
+
+STATIC const Pwm_ConfigChannel* Pwm_Channels = NULL_PTR;
+STATIC uint8					Pwm_Status = PWM_NOT_INITIALIZED;
+
+/* Base address of every PWM module */
+STATIC const uint32 Pwm_ModuleBaseAddress[PWM_NUMBER_OF_MODULES] = {PWM0_BASE_ADDRESS, PWM1_BASE_ADDRESS};
+
+/* Generators of every module with PWM_UPDATE_SYNC channels, the PWMCTL value of Pwm_SyncUpdate */
+STATIC uint8 Pwm_SyncGenerators[PWM_NUMBER_OF_MODULES];
+
+/************************************************************************************
+* Function Name		: Pwm_GeneratorControl
+* Description		: Returns the PWMnCTL bits of a channel: generator enabled and the update mode
+*					  of the compare and action registers of its output.
+************************************************************************************/
+STATIC uint32 Pwm_GeneratorControl(const Pwm_ConfigChannel* Channel)
+{
+	uint32 Control;
+
+	if (PWM_UPDATE_SYNC == Channel->Update)
+	{
+		Control = (PWM_OUTPUT_A == Channel->Output) ? (PWM_GEN_CTL_CMPAUPD_GLOBAL | PWM_GEN_CTL_GENAUPD_GLOBAL)
+													: (PWM_GEN_CTL_CMPBUPD_GLOBAL | PWM_GEN_CTL_GENBUPD_GLOBAL);
+	}
+	else
+	{
+		Control = (PWM_OUTPUT_A == Channel->Output) ? PWM_GEN_CTL_GENAUPD_LOCAL : PWM_GEN_CTL_GENBUPD_LOCAL;
+	}
+
+	return PWM_GEN_CTL_ENABLE | Control;
+}
+
+/************************************************************************************
+* Function Name		: Pwm_WriteDuty
+* Description		: Writes the compare value and the actions of the output of a channel. A
+*					  duty cycle of 0% or 100% has no compare match, the output is then held
+*					  by the action at the load of the period.
+************************************************************************************/
+STATIC void Pwm_WriteDuty(const Pwm_ConfigChannel* Channel, uint16 DutyCycle)
+{
+	uint32 Base = Pwm_ModuleBaseAddress[Channel->Module_Num] + PWM_O_GEN(Channel->Generator_Num);
+	uint32 Active = (Channel->Period * (uint32)DutyCycle) >> 15U;
+	uint32 Action;
+
+	if (0U == Active)
+	{
+		Action = PWM_GEN_ACT_LOAD_LOW;
+	}
+	else if (Active >= Channel->Period)
+	{
+		Action = PWM_GEN_ACT_LOAD_HIGH;
+	}
+	else
+	{
+		/* The counter goes from Period - 1 down to 0, the output is active until it reaches the compare */
+		Action = PWM_GEN_ACT_LOAD_HIGH | ((PWM_OUTPUT_A == Channel->Output) ? PWM_GEN_ACT_CMPAD_LOW
+																			: PWM_GEN_ACT_CMPBD_LOW);
+		PWM_REG(Base, (PWM_OUTPUT_A == Channel->Output) ? PWM_O_GEN_CMPA : PWM_O_GEN_CMPB) =
+			Channel->Period - 1U - Active;
+	}
+
+	PWM_REG(Base, (PWM_OUTPUT_A == Channel->Output) ? PWM_O_GEN_GENA : PWM_O_GEN_GENB) = Action;
+}
+
+/************************************************************************************
+ * Service name      : Pwm_Init
+*  Syntax            : void Pwm_Init(const Pwm_ConfigType* ConfigPtr)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x00
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : ConfigPtr - Pointer to post-build configuration data
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to Initialize the Pwm module, every channel starts with its
+*                      period and default duty cycle.
+ ************************************************************************************/
+void Pwm_Init(const Pwm_ConfigType* ConfigPtr)
+{
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_INIT_SID, PWM_E_PARAM_CONFIG);
+	}
+	else if (PWM_INITIALIZED == Pwm_Status)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_INIT_SID, PWM_E_ALREADY_INITIALIZED);
+	}
+	else
+#endif
+	{
+		uint8 UsedModules = 0U;
+
+		Pwm_Channels = ConfigPtr->Channels;
+
+		for (Pwm_ChannelType Channel = 0U; Channel < PWM_CONFIGURED_CHANNELS; Channel++)
+		{
+			SET_BIT(UsedModules, Pwm_Channels[Channel].Module_Num);
+		}
+
+		/* Enable the clock of all the used modules in one write */
+		SET_MASK(RCGCPWM, UsedModules);
+
+		while ((PRPWM & UsedModules) != UsedModules)
+		{
+			/* Do Nothing */
+		}
+
+		/* PWMnCTL value of every generator and outputs of every module, written after all the channels */
+		uint32 GeneratorControl[PWM_NUMBER_OF_MODULES][PWM_NUMBER_OF_GENERATORS] = {{0U}};
+		uint8  Outputs[PWM_NUMBER_OF_MODULES] = {0U};
+
+		for (Pwm_ChannelType Channel = 0U; Channel < PWM_CONFIGURED_CHANNELS; Channel++)
+		{
+			const Pwm_ConfigChannel* Config = &Pwm_Channels[Channel];
+			uint32					 Module = Pwm_ModuleBaseAddress[Config->Module_Num];
+			uint32					 Base = Module + PWM_O_GEN(Config->Generator_Num);
+			uint8					 OutputNum = (uint8)((Config->Generator_Num * 2U) + (uint8)Config->Output);
+
+			/* Generator stopped while its period is loaded, count-down mode */
+			PWM_REG(Base, PWM_O_GEN_CTL) = 0U;
+			PWM_REG(Base, PWM_O_GEN_LOAD) = Config->Period - 1U;
+			Pwm_WriteDuty(Config, Config->Default_Duty);
+
+			if (PWM_LOW == Config->Polarity)
+			{
+				SET_BIT(PWM_REG(Module, PWM_O_INVERT), OutputNum);
+			}
+			else
+			{
+				CLEAR_BIT(PWM_REG(Module, PWM_O_INVERT), OutputNum);
+			}
+
+			/* The two outputs of a generator share its control register */
+			GeneratorControl[Config->Module_Num][Config->Generator_Num] |= Pwm_GeneratorControl(Config);
+			SET_BIT(Outputs[Config->Module_Num], OutputNum);
+
+			if (PWM_UPDATE_SYNC == Config->Update)
+			{
+				SET_BIT(Pwm_SyncGenerators[Config->Module_Num], Config->Generator_Num);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		for (uint8 ModuleNum = 0U; ModuleNum < PWM_NUMBER_OF_MODULES; ModuleNum++)
+		{
+			uint32 Module = Pwm_ModuleBaseAddress[ModuleNum];
+			uint8  Generators = 0U;
+
+			for (uint8 GeneratorNum = 0U; GeneratorNum < PWM_NUMBER_OF_GENERATORS; GeneratorNum++)
+			{
+				if (0U != GeneratorControl[ModuleNum][GeneratorNum])
+				{
+					PWM_REG(Module + PWM_O_GEN(GeneratorNum), PWM_O_GEN_CTL) =
+						GeneratorControl[ModuleNum][GeneratorNum];
+					SET_BIT(Generators, GeneratorNum);
+				}
+				else
+				{
+					/* No Action Required */
+				}
+			}
+
+			if (0U != Generators)
+			{
+				/* Restart the counters of the generators together, so that the synchronized updates
+				 * reach all their outputs at the same time */
+				PWM_REG(Module, PWM_O_SYNC) = Generators;
+				SET_MASK(PWM_REG(Module, PWM_O_ENABLE), Outputs[ModuleNum]);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		Pwm_Status = PWM_INITIALIZED;
+	}
+}
+
+/************************************************************************************
+ * Service name      : Pwm_SetDutyCycle
+*  Syntax            : void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x02
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant for different channel numbers
+*  Parameters (in)   : ChannelNumber - Numeric identifier of the PWM channel
+*                      DutyCycle - 0x0000 (0%) to 0x8000 (100%)
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to set the duty cycle of a channel, the generator takes it
+*                      at the end of the current period (after Pwm_SyncUpdate for the
+*                      PWM_UPDATE_SYNC channels).
+ ************************************************************************************/
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+{
+	boolean error = FALSE;
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (PWM_NOT_INITIALIZED == Pwm_Status)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_SET_DUTY_CYCLE_SID, PWM_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (PWM_CONFIGURED_CHANNELS <= ChannelNumber)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_SET_DUTY_CYCLE_SID, PWM_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the duty cycle is not above 100% */
+	if (PWM_DUTY_100_PERCENT < DutyCycle)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_SET_DUTY_CYCLE_SID, PWM_E_PARAM_DUTY);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if (FALSE == error)
+	{
+		Pwm_WriteDuty(&Pwm_Channels[ChannelNumber], DutyCycle);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Service name      : Pwm_SyncUpdate
+*  Syntax            : void Pwm_SyncUpdate(void)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x20
+*  Sync/Async        : Asynchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to apply together the duty cycles set on the PWM_UPDATE_SYNC
+*                      channels, one register write per PWM module whatever the PWM frequency.
+ ************************************************************************************/
+void Pwm_SyncUpdate(void)
+{
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (PWM_NOT_INITIALIZED == Pwm_Status)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_SYNC_UPDATE_SID, PWM_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for (uint8 ModuleNum = 0U; ModuleNum < PWM_NUMBER_OF_MODULES; ModuleNum++)
+		{
+			if (0U != Pwm_SyncGenerators[ModuleNum])
+			{
+				/* GLOBALSYNCn bits, cleared by the hardware once the generators took the updates */
+				PWM_REG(Pwm_ModuleBaseAddress[ModuleNum], PWM_O_CTL) = Pwm_SyncGenerators[ModuleNum];
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+}
+
+#if (PWM_SET_OUTPUT_TO_IDLE_API == STD_ON)
+/************************************************************************************
+ * Service name      : Pwm_SetOutputToIdle
+*  Syntax            : void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x04
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant for different channel numbers
+*  Parameters (in)   : ChannelNumber - Numeric identifier of the PWM channel
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to hold the output of a channel at its idle state from the
+*                      end of the current period.
+ ************************************************************************************/
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber)
+{
+	boolean error = FALSE;
+
+	#if (PWM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (PWM_NOT_INITIALIZED == Pwm_Status)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_SET_OUTPUT_TO_IDLE_SID, PWM_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (PWM_CONFIGURED_CHANNELS <= ChannelNumber)
+	{
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_SET_OUTPUT_TO_IDLE_SID, PWM_E_PARAM_CHANNEL);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	#endif
+
+	if (FALSE == error)
+	{
+		const Pwm_ConfigChannel* Channel = &Pwm_Channels[ChannelNumber];
+
+		/* The idle state is the active level for the whole period or for none of it */
+		Pwm_WriteDuty(Channel, (Channel->Idle_State == Channel->Polarity) ? PWM_DUTY_100_PERCENT
+																		  : PWM_DUTY_0_PERCENT);
+
+		if (PWM_UPDATE_SYNC == Channel->Update)
+		{
+			/* Also applies the updates pending on the other output of the generator */
+			PWM_REG(Pwm_ModuleBaseAddress[Channel->Module_Num], PWM_O_CTL) = BIT(Channel->Generator_Num);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+#if (PWM_VERSION_INFO_API == STD_ON)
+/************************************************************************************
+ * Service name      : Pwm_GetVersionInfo
+*  Syntax            : void Pwm_GetVersionInfo(Std_VersionInfoType* versioninfo)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x08
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : versioninfo - Pointer to where to store the version information of this module.
+*  Return value      : None
+*  Description       : Function to get the version information of this module.
+ ************************************************************************************/
+void Pwm_GetVersionInfo(Std_VersionInfoType* versioninfo)
+{
+	#if (PWM_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_GET_VERSION_INFO_SID, PWM_E_PARAM_POINTER);
+	}
+	else
+	#endif /* (PWM_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)PWM_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)PWM_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)PWM_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)PWM_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)PWM_SW_PATCH_VERSION;
+	}
+}
+#endif
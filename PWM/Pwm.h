@@ -0,0 +1,207 @@
+/******************************************************************
+ * @Module   	: Pwm
+ * @Title 	 	: PWM Module Header File
+ * @Filename 	: Pwm.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: Fixed period channels on the outputs of the PWM generators,
+ *                the generators count down from the period to 0.
+ ********************************************************************/
+
+#ifndef PWM_H
+#define PWM_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define PWM_VENDOR_ID				 (1000U)
+
+/* Pwm Module Id */
+#define PWM_MODULE_ID				 (121U)
+
+/* Pwm Instance Id */
+#define PWM_INSTANCE_ID				 (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define PWM_SW_MAJOR_VERSION		 (1U)
+#define PWM_SW_MINOR_VERSION		 (0U)
+#define PWM_SW_PATCH_VERSION		 (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PWM_AR_RELEASE_MAJOR_VERSION (4U)
+#define PWM_AR_RELEASE_MINOR_VERSION (0U)
+#define PWM_AR_RELEASE_PATCH_VERSION (3U)
+
+/*
+ * Macros for Pwm Status
+ */
+#define PWM_INITIALIZED				 (1U)
+#define PWM_NOT_INITIALIZED			 (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Pwm Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Pwm Pre-Compile Configuration Header file */
+#include "Pwm_Cfg.h"
+
+/* AUTOSAR Version checking between Pwm_Cfg.h and Pwm.h files */
+#if ((PWM_CFG_AR_RELEASE_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION) || \
+	 (PWM_CFG_AR_RELEASE_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION) || \
+	 (PWM_CFG_AR_RELEASE_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Pwm_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Pwm_Cfg.h and Pwm.h files */
+#if ((PWM_CFG_SW_MAJOR_VERSION != PWM_SW_MAJOR_VERSION) || \
+	 (PWM_CFG_SW_MINOR_VERSION != PWM_SW_MINOR_VERSION) || \
+	 (PWM_CFG_SW_PATCH_VERSION != PWM_SW_PATCH_VERSION))
+	#error "The SW version of Pwm_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for PWM Init */
+#define PWM_INIT_SID				 (uint8)0x00
+
+/* Service ID for PWM set Duty Cycle */
+#define PWM_SET_DUTY_CYCLE_SID		 (uint8)0x02
+
+/* Service ID for PWM set Output to Idle */
+#define PWM_SET_OUTPUT_TO_IDLE_SID	 (uint8)0x04
+
+/* Service ID for PWM GetVersionInfo */
+#define PWM_GET_VERSION_INFO_SID	 (uint8)0x08
+
+/* Service ID for PWM sync Update (not AUTOSAR) */
+#define PWM_SYNC_UPDATE_SID			 (uint8)0x20
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* Pwm_Init API service called with NULL pointer parameter */
+#define PWM_E_PARAM_CONFIG			 (uint8)0x10
+
+/* DET code to report that an API service is called without module initialization */
+#define PWM_E_UNINIT				 (uint8)0x11
+
+/* DET code to report Invalid Channel */
+#define PWM_E_PARAM_CHANNEL			 (uint8)0x12
+
+/* DET code to report that Pwm_Init is called while the driver is already initialized */
+#define PWM_E_ALREADY_INITIALIZED	 (uint8)0x14
+
+/* DET code to report that an API service is called with a NULL pointer parameter */
+#define PWM_E_PARAM_POINTER			 (uint8)0x15
+
+/* DET code to report a duty cycle above 100% (0x8000) */
+#define PWM_E_PARAM_DUTY			 (uint8)0x16
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Pwm_ChannelType used by the PWM APIs */
+typedef uint8 Pwm_ChannelType;
+
+/* Type definition for Pwm_PeriodType, a number of PWM clock ticks */
+typedef uint32 Pwm_PeriodType;
+
+/* Enumeration for Pwm_OutputStateType, level of an output */
+typedef enum
+{
+	PWM_HIGH,
+	PWM_LOW
+} Pwm_OutputStateType;
+
+/* Enumeration for Pwm_OutputType, output of a generator (pwmA / pwmB) */
+typedef enum
+{
+	PWM_OUTPUT_A,
+	PWM_OUTPUT_B
+} Pwm_OutputType;
+
+/* Enumeration for Pwm_UpdateType, when a new duty cycle reaches the output */
+typedef enum
+{
+	PWM_UPDATE_END_OF_PERIOD, /* at the end of the current period */
+	PWM_UPDATE_SYNC			  /* at the end of the period following the next Pwm_SyncUpdate */
+} Pwm_UpdateType;
+
+typedef struct
+{
+	/* Member contains the number of the PWM module (PWM0 or PWM1) */
+	uint8 Module_Num;
+	/* Member contains the number of the generator in the module (0 to 3) */
+	uint8 Generator_Num;
+	/* Member contains the output of the generator */
+	Pwm_OutputType Output;
+	/* Member contains the period in PWM clock ticks */
+	Pwm_PeriodType Period;
+	/* Member contains the duty cycle set by Pwm_Init */
+	uint16 Default_Duty;
+	/* Member contains the level of the output during the active part of the period */
+	Pwm_OutputStateType Polarity;
+	/* Member contains the level of the output set by Pwm_SetOutputToIdle */
+	Pwm_OutputStateType Idle_State;
+	/* Member contains when the duty cycle updates are applied */
+	Pwm_UpdateType Update;
+} Pwm_ConfigChannel;
+
+/* Data Structure required for initializing the Pwm Driver */
+typedef struct Pwm_ConfigType
+{
+	Pwm_ConfigChannel Channels[PWM_CONFIGURED_CHANNELS];
+} Pwm_ConfigType;
+
+/* Duty cycle limits of Pwm_SetDutyCycle */
+#define PWM_DUTY_0_PERCENT			 (uint16)0x0000
+#define PWM_DUTY_100_PERCENT		 (uint16)0x8000
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for PWM Initialization API */
+void Pwm_Init(const Pwm_ConfigType* ConfigPtr);
+
+/* Function for PWM set Duty Cycle API, 0x0000 is 0% and 0x8000 is 100%. The new duty cycle
+ * is taken at the end of a period, so the output never gets a truncated pulse */
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle);
+
+/* Function for PWM sync Update API, the duty cycles set since the last call on the PWM_UPDATE_SYNC
+ * channels are applied together at the end of the current period of their generators */
+void Pwm_SyncUpdate(void);
+
+#if (PWM_SET_OUTPUT_TO_IDLE_API == STD_ON)
+/* Function for PWM set Output to Idle API, Pwm_SetDutyCycle restarts the channel */
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber);
+#endif
+
+#if (PWM_VERSION_INFO_API == STD_ON)
+/* Function for PWM Get Version Info API */
+void Pwm_GetVersionInfo(Std_VersionInfoType* versioninfo);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Pwm and other modules */
+extern const Pwm_ConfigType Pwm_Configuration;
+
+#endif /* PWM_H */
@@ -0,0 +1,86 @@
+/******************************************************************
+ * @Module   	: Pwm
+ * @Title 	 	: PWM Pre-Compile Configuration Header File 
+ * @Filename 	: Pwm_Cfg.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: 
+ ********************************************************************/
+
+#ifndef PWM_CFG_H
+#define PWM_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define PWM_CFG_SW_MAJOR_VERSION		   (1U)
+#define PWM_CFG_SW_MINOR_VERSION		   (0U)
+#define PWM_CFG_SW_PATCH_VERSION		   (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PWM_CFG_AR_RELEASE_MAJOR_VERSION   (4U)
+#define PWM_CFG_AR_RELEASE_MINOR_VERSION   (0U)
+#define PWM_CFG_AR_RELEASE_PATCH_VERSION   (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define PWM_DEV_ERROR_DETECT			   (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define PWM_VERSION_INFO_API			   (STD_ON)
+
+/* Pre-compile option for presence of Pwm_SetOutputToIdle API */
+#define PWM_SET_OUTPUT_TO_IDLE_API		   (STD_ON)
+
+/* Clock of the PWM modules (system clock, the PWM divider is not used) */
+#define PWM_CLOCK_FREQUENCY_HZ			   (16000000U)
+
+/* Number of the configured Pwm Channels */
+#define PWM_CONFIGURED_CHANNELS			   (3U)
+
+/* Channel Index in the array of structures in Pwm_PBcfg.c */
+#define PwmConf_LED_RED_CHANNEL_ID_INDEX   (Pwm_ChannelType)0
+#define PwmConf_LED_GREEN_CHANNEL_ID_INDEX (Pwm_ChannelType)1
+#define PwmConf_LED_BLUE_CHANNEL_ID_INDEX  (Pwm_ChannelType)2
+
+/* PWM module, generator and output of every channel, the two outputs of a generator share its period */
+#define PwmConf_LED_RED_MODULE_NUM		   (uint8)1					   /* PWM1 */
+#define PwmConf_LED_RED_GENERATOR_NUM	   (uint8)2					   /* Generator 2 */
+#define PwmConf_LED_RED_OUTPUT			   (Pwm_OutputType) PWM_OUTPUT_B /* M1PWM5 on PF1 */
+#define PwmConf_LED_GREEN_MODULE_NUM	   (uint8)1					   /* PWM1 */
+#define PwmConf_LED_GREEN_GENERATOR_NUM	   (uint8)3					   /* Generator 3 */
+#define PwmConf_LED_GREEN_OUTPUT		   (Pwm_OutputType) PWM_OUTPUT_B /* M1PWM7 on PF3 */
+#define PwmConf_LED_BLUE_MODULE_NUM		   (uint8)1					   /* PWM1 */
+#define PwmConf_LED_BLUE_GENERATOR_NUM	   (uint8)3					   /* Generator 3 */
+#define PwmConf_LED_BLUE_OUTPUT			   (Pwm_OutputType) PWM_OUTPUT_A /* M1PWM6 on PF2 */
+
+/* Period of every channel in PWM clock ticks (2 to 65536) */
+#define PwmConf_LED_RED_PERIOD			   (Pwm_PeriodType)(PWM_CLOCK_FREQUENCY_HZ / 1000U) /* 1 kHz */
+#define PwmConf_LED_GREEN_PERIOD		   (Pwm_PeriodType)(PWM_CLOCK_FREQUENCY_HZ / 1000U) /* 1 kHz */
+#define PwmConf_LED_BLUE_PERIOD			   (Pwm_PeriodType)(PWM_CLOCK_FREQUENCY_HZ / 1000U) /* 1 kHz */
+
+/* Duty cycle set by Pwm_Init (0x0000 = 0%, 0x8000 = 100%) */
+#define PwmConf_LED_RED_DEFAULT_DUTY	   (uint16)0x0000
+#define PwmConf_LED_GREEN_DEFAULT_DUTY	   (uint16)0x0000
+#define PwmConf_LED_BLUE_DEFAULT_DUTY	   (uint16)0x0000
+
+/* Level of the output during the active part of the period and in the idle state */
+#define PwmConf_LED_RED_POLARITY		   (Pwm_OutputStateType) PWM_HIGH
+#define PwmConf_LED_RED_IDLE_STATE		   (Pwm_OutputStateType) PWM_LOW
+#define PwmConf_LED_GREEN_POLARITY		   (Pwm_OutputStateType) PWM_HIGH
+#define PwmConf_LED_GREEN_IDLE_STATE	   (Pwm_OutputStateType) PWM_LOW
+#define PwmConf_LED_BLUE_POLARITY		   (Pwm_OutputStateType) PWM_HIGH
+#define PwmConf_LED_BLUE_IDLE_STATE		   (Pwm_OutputStateType) PWM_LOW
+
+/*
+ * PWM_UPDATE_END_OF_PERIOD: a new duty cycle is taken at the end of the current period
+ * PWM_UPDATE_SYNC         : the new duty cycles of the channels are held until Pwm_SyncUpdate, which
+ *                           applies them together at the end of the period (the RGB LED colors)
+ */
+#define PwmConf_LED_RED_UPDATE			   (Pwm_UpdateType) PWM_UPDATE_SYNC
+#define PwmConf_LED_GREEN_UPDATE		   (Pwm_UpdateType) PWM_UPDATE_SYNC
+#define PwmConf_LED_BLUE_UPDATE			   (Pwm_UpdateType) PWM_UPDATE_SYNC
+
+#endif /* PWM_CFG_H */
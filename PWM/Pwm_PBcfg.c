@@ -0,0 +1,82 @@
+/******************************************************************
+ * @Module   	: Pwm
+ * @Title 	 	: PWM Post Build Configuration Source file
+ * @Filename 	: Pwm_PBcfg.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR 
+ * @Notes    	: 
+ ********************************************************************/
+
+#include "Pwm.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define PWM_PBCFG_SW_MAJOR_VERSION		   (1U)
+#define PWM_PBCFG_SW_MINOR_VERSION		   (0U)
+#define PWM_PBCFG_SW_PATCH_VERSION		   (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PWM_PBCFG_AR_RELEASE_MAJOR_VERSION (4U)
+#define PWM_PBCFG_AR_RELEASE_MINOR_VERSION (0U)
+#define PWM_PBCFG_AR_RELEASE_PATCH_VERSION (3U)
+
+/* AUTOSAR Version checking between Pwm_PBcfg.c and Pwm.h files */
+#if ((PWM_PBCFG_AR_RELEASE_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION) || \
+	 (PWM_PBCFG_AR_RELEASE_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION) || \
+	 (PWM_PBCFG_AR_RELEASE_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Pwm_PBcfg.c and Pwm.h files */
+#if ((PWM_PBCFG_SW_MAJOR_VERSION != PWM_SW_MAJOR_VERSION) || \
+	 (PWM_PBCFG_SW_MINOR_VERSION != PWM_SW_MINOR_VERSION) || \
+	 (PWM_PBCFG_SW_PATCH_VERSION != PWM_SW_PATCH_VERSION))
+	#error "The SW version of PBcfg.c does not match the expected version"
+#endif
+/* PB structure used with Pwm_Init API */
+const Pwm_ConfigType Pwm_Configuration = {
+
+	.Channels =
+		{
+
+			[PwmConf_LED_RED_CHANNEL_ID_INDEX] =
+				{
+					.Module_Num = PwmConf_LED_RED_MODULE_NUM,
+					.Generator_Num = PwmConf_LED_RED_GENERATOR_NUM,
+					.Output = PwmConf_LED_RED_OUTPUT,
+					.Period = PwmConf_LED_RED_PERIOD,
+					.Default_Duty = PwmConf_LED_RED_DEFAULT_DUTY,
+					.Polarity = PwmConf_LED_RED_POLARITY,
+					.Idle_State = PwmConf_LED_RED_IDLE_STATE,
+					.Update = PwmConf_LED_RED_UPDATE,
+				},
+			[PwmConf_LED_GREEN_CHANNEL_ID_INDEX] =
+				{
+					.Module_Num = PwmConf_LED_GREEN_MODULE_NUM,
+					.Generator_Num = PwmConf_LED_GREEN_GENERATOR_NUM,
+					.Output = PwmConf_LED_GREEN_OUTPUT,
+					.Period = PwmConf_LED_GREEN_PERIOD,
+					.Default_Duty = PwmConf_LED_GREEN_DEFAULT_DUTY,
+					.Polarity = PwmConf_LED_GREEN_POLARITY,
+					.Idle_State = PwmConf_LED_GREEN_IDLE_STATE,
+					.Update = PwmConf_LED_GREEN_UPDATE,
+				},
+			[PwmConf_LED_BLUE_CHANNEL_ID_INDEX] =
+				{
+					.Module_Num = PwmConf_LED_BLUE_MODULE_NUM,
+					.Generator_Num = PwmConf_LED_BLUE_GENERATOR_NUM,
+					.Output = PwmConf_LED_BLUE_OUTPUT,
+					.Period = PwmConf_LED_BLUE_PERIOD,
+					.Default_Duty = PwmConf_LED_BLUE_DEFAULT_DUTY,
+					.Polarity = PwmConf_LED_BLUE_POLARITY,
+					.Idle_State = PwmConf_LED_BLUE_IDLE_STATE,
+					.Update = PwmConf_LED_BLUE_UPDATE,
+				}
+
+		}
+
+};
@@ -0,0 +1,495 @@
+/******************************************************************
+ * @Module   	: Uart
+ * @Title 	 	: UART Driver Source file
+ * @Filename 	: Uart.c
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	: Both ring buffers have one writer and one reader: Uart_Write and the UART0 interrupt
+ *                for the transmit buffer, the UART0 interrupt and Uart_Read for the receive buffer.
+ *                The indexes run freely, their difference is the number of bytes in the buffer.
+ *                Every uDMA transfer is started by the interrupt, Uart_Write only pends it when the
+ *                uDMA is idle, so the task never races the interrupt for the channel.
+ ********************************************************************/
+
+#include "Uart.h"
+#include "Peripheral_Regs.h"
+#include "Irq.h"
+
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+
+	#include "Det.h"
+
+	/* AUTOSAR Version checking between Det and Uart Modules */
+	#if ((DET_AR_MAJOR_VERSION != UART_AR_RELEASE_MAJOR_VERSION) || \
+		 (DET_AR_MINOR_VERSION != UART_AR_RELEASE_MINOR_VERSION) || \
+		 (DET_AR_PATCH_VERSION != UART_AR_RELEASE_PATCH_VERSION))
+		#error "The AR version of Det.h does not match the expected version"
+	#endif
+
+#endif
+
+#if ((0U == UART_TX_BUFFER_SIZE) || (0U != (UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1U))))
+	#error "UART_TX_BUFFER_SIZE must be a power of 2"
+#endif
+
+#if ((0U == UART_RX_BUFFER_SIZE) || (0U != (UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1U))))
+	#error "UART_RX_BUFFER_SIZE must be a power of 2"
+#endif
+
+#if (UART_HIGH_SPEED == STD_ON)
+	#define UART_SAMPLES_PER_BIT (8U)
+	#define UART_CTL_SPEED		 (0x00000020U) /* UARTCTL.HSE */
+#else
+	#define UART_SAMPLES_PER_BIT (16U)
+	#define UART_CTL_SPEED		 (0x00000000U)
+#endif
+
+#if ((UART_BAUD_RATE * UART_SAMPLES_PER_BIT) > UART_CLOCK_FREQUENCY_HZ)
+	#error "UART_BAUD_RATE is above the UART clock, set UART_HIGH_SPEED"
+#endif
+
+/* Baud-rate divisor in 64ths, rounded: IBRD is its integer part and FBRD its 6 fraction bits */
+#define UART_BAUD_DIVISOR \
+	((((UART_CLOCK_FREQUENCY_HZ * (128U / UART_SAMPLES_PER_BIT)) / UART_BAUD_RATE) + 1U) / 2U)
+
+/* UART0: interrupt number and uDMA channel of its TX requests (channel 9, encoding 0) */
+#define UART_IRQ_NUMBER			 (Irq_NumberType)5
+#define UART_TX_DMA_CHANNEL		 (9U)
+#define UART_TX_DMA_CHMAP_MASK	 (0x000000F0U) /* CH9SEL field of DMACHMAP1 */
+
+/* UARTFR: receive FIFO empty */
+#define UART_FR_RXFE			 (0x00000010U)
+
+/* UARTDR: error flags received with the byte */
+#define UART_DR_FE				 (0x00000100U)
+#define UART_DR_PE				 (0x00000200U)
+#define UART_DR_BE				 (0x00000400U)
+#define UART_DR_OE				 (0x00000800U)
+
+/* UARTLCRH: 8 data bits, FIFOs enabled, no parity and 1 stop bit */
+#define UART_LCRH_8N1_FIFO		 (0x00000070U)
+
+/* UARTCTL: UART, transmit and receive enable */
+#define UART_CTL_ENABLE			 (0x00000301U)
+
+/* UARTIFLS: receive interrupt at 14 bytes (7/8), transmit uDMA burst at 8 free bytes (1/2) */
+#define UART_IFLS_RX7_8_TX1_2	 (0x00000022U)
+
+/* UARTIM/MIS/ICR: receive and receive time-out interrupts, every interrupt source */
+#define UART_INT_RX				 (0x00000010U)
+#define UART_INT_RT				 (0x00000040U)
+#define UART_INT_ALL			 (0x000007F2U)
+
+/* UARTDMACTL: transmit uDMA requests enable */
+#define UART_DMACTL_TXDMAE		 (0x00000002U)
+
+/* DMACFG: controller enable */
+#define UDMA_CFG_MASTEN			 (0x00000001U)
+
+/* DMACHCTL of a transmit transfer: bytes from an incremented source to the fixed UARTDR, arbitration
+ * every 4 bytes, basic mode. XFERSIZE holds the number of bytes minus one. */
+#define UART_TX_DMA_CONTROL		 (0xC0008001U)
+#define UDMA_CHCTL_XFERSIZE_SHIFT (4U)
+#define UDMA_MAX_TRANSFER		 (1024U)
+
+/* Alignment of the uDMA control table */
+#define UDMA_CONTROL_TABLE_ALIGN (1024U)
+
+/* uDMA control table, only the entries up to the transmit channel are ever read by the controller */
+DATA_ALIGNMENT(UDMA_CONTROL_TABLE_ALIGN)
+STATIC volatile UDMA_ControlType Uart_DmaControlTable[UART_TX_DMA_CHANNEL + 1U];
+
+STATIC boolean Uart_Initialized = FALSE;
+
+/* Transmit ring buffer: Uart_TxHead is written by Uart_Write, Uart_TxTail by the interrupt once the
+ * uDMA sent Uart_TxChunk bytes (0 while the uDMA is idle) */
+STATIC uint8		   Uart_TxBuffer[UART_TX_BUFFER_SIZE];
+STATIC volatile uint32 Uart_TxHead = 0U;
+STATIC volatile uint32 Uart_TxTail = 0U;
+STATIC volatile uint32 Uart_TxChunk = 0U;
+
+/* Receive ring buffer: Uart_RxHead is written by the interrupt, Uart_RxTail by Uart_Read */
+STATIC uint8		   Uart_RxBuffer[UART_RX_BUFFER_SIZE];
+STATIC volatile uint32 Uart_RxHead = 0U;
+STATIC volatile uint32 Uart_RxTail = 0U;
+
+STATIC Uart_StatisticsType Uart_Statistics;
+
+/************************************************************************************
+* Function Name		: Uart_StartTransmit
+* Description		: Called by the interrupt while the uDMA is idle, starts the transfer of the
+*					  bytes of the transmit buffer up to its end (the next transfer wraps).
+************************************************************************************/
+STATIC void Uart_StartTransmit(void)
+{
+	uint32 Pending = Uart_TxHead - Uart_TxTail;
+
+	if (0U != Pending)
+	{
+		uint32 Index = Uart_TxTail & (UART_TX_BUFFER_SIZE - 1U);
+		uint32 Chunk = UART_TX_BUFFER_SIZE - Index;
+
+		if (Chunk > Pending)
+		{
+			Chunk = Pending;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		if (Chunk > UDMA_MAX_TRANSFER)
+		{
+			Chunk = UDMA_MAX_TRANSFER;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		Uart_DmaControlTable[UART_TX_DMA_CHANNEL].SRCENDP = (uint32)&Uart_TxBuffer[Index + Chunk - 1U];
+		Uart_DmaControlTable[UART_TX_DMA_CHANNEL].CHCTL =
+			UART_TX_DMA_CONTROL | ((Chunk - 1U) << UDMA_CHCTL_XFERSIZE_SHIFT);
+		Uart_TxChunk = Chunk;
+
+		/* The control word is in memory before the channel reads it */
+		DATA_SYNC_BARRIER();
+		UDMA_ENASET = BIT(UART_TX_DMA_CHANNEL);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Function Name		: Uart_Receive
+* Description		: Moves the content of the RX FIFO to the receive buffer. The bytes received
+*					  with an error are counted and dropped.
+************************************************************************************/
+STATIC void Uart_Receive(void)
+{
+	uint32 Head = Uart_RxHead;
+	uint32 Tail = Uart_RxTail;
+
+	while (0U == (UART_REG(UART0_BASE_ADDRESS, UART_O_FR) & UART_FR_RXFE))
+	{
+		uint32 Data = UART_REG(UART0_BASE_ADDRESS, UART_O_DR);
+
+		if (0U != (Data & UART_DR_OE))
+		{
+			Uart_Statistics.RxOverruns++;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		if (0U != (Data & (UART_DR_FE | UART_DR_PE | UART_DR_BE)))
+		{
+			Uart_Statistics.RxErrors++;
+		}
+		else if ((Head - Tail) < UART_RX_BUFFER_SIZE)
+		{
+			Uart_RxBuffer[Head & (UART_RX_BUFFER_SIZE - 1U)] = (uint8)Data;
+			Head++;
+		}
+		else
+		{
+			Uart_Statistics.RxDropped++;
+		}
+	}
+
+	Uart_RxHead = Head;
+}
+
+/************************************************************************************
+* Function Name		: UART0_Handler
+* Description		: UART0 interrupt, installed at run time by Uart_Init. It is entered for the
+*					  receive FIFO level and time-out, for the end of a transmit uDMA transfer and
+*					  when Uart_Write pends it to start the uDMA.
+************************************************************************************/
+STATIC void UART0_Handler(void)
+{
+	uint32 Status = UART_REG(UART0_BASE_ADDRESS, UART_O_MIS);
+
+	UART_REG(UART0_BASE_ADDRESS, UART_O_ICR) = Status;
+
+	if (0U != (UDMA_CHIS & BIT(UART_TX_DMA_CHANNEL)))
+	{
+		UDMA_CHIS = BIT(UART_TX_DMA_CHANNEL);
+		Uart_TxTail += Uart_TxChunk;
+		Uart_TxChunk = 0U;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if (0U == Uart_TxChunk)
+	{
+		Uart_StartTransmit();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if (0U != (Status & (UART_INT_RX | UART_INT_RT)))
+	{
+		Uart_Receive();
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Service name      : Uart_Init
+*  Syntax            : void Uart_Init(void)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x00
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : None
+*  Description       : Function to Initialize the Uart driver: UART0 at UART_BAUD_RATE 8N1 with its
+*                      FIFOs, and the uDMA channel of its transmit requests. The driver owns the
+*                      uDMA control table.
+ ************************************************************************************/
+void Uart_Init(void)
+{
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+	if (TRUE == Uart_Initialized)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_INIT_SID, UART_E_ALREADY_INITIALIZED);
+	}
+	else
+#endif
+	{
+		SET_BIT(RCGCUART, 0U);
+		SET_BIT(RCGCDMA, 0U);
+
+		while ((0U == (PRUART & 1U)) || (0U == (PRDMA & 1U)))
+		{
+			/* Do Nothing */
+		}
+
+		UART_REG(UART0_BASE_ADDRESS, UART_O_CTL) = 0U;
+		UART_REG(UART0_BASE_ADDRESS, UART_O_IBRD) = UART_BAUD_DIVISOR >> 6U;
+		UART_REG(UART0_BASE_ADDRESS, UART_O_FBRD) = UART_BAUD_DIVISOR & 0x3FU;
+		/* The divisors are latched by the write of UARTLCRH */
+		UART_REG(UART0_BASE_ADDRESS, UART_O_LCRH) = UART_LCRH_8N1_FIFO;
+		UART_REG(UART0_BASE_ADDRESS, UART_O_CC) = 0U;
+		UART_REG(UART0_BASE_ADDRESS, UART_O_IFLS) = UART_IFLS_RX7_8_TX1_2;
+		UART_REG(UART0_BASE_ADDRESS, UART_O_ICR) = UART_INT_ALL;
+		UART_REG(UART0_BASE_ADDRESS, UART_O_IM) = UART_INT_RX | UART_INT_RT;
+		UART_REG(UART0_BASE_ADDRESS, UART_O_DMACTL) = UART_DMACTL_TXDMAE;
+
+		UDMA_CFG = UDMA_CFG_MASTEN;
+		UDMA_CTLBASE = (uint32)Uart_DmaControlTable;
+		UDMA_CHMAP1 &= ~UART_TX_DMA_CHMAP_MASK;
+		UDMA_ALTCLR = BIT(UART_TX_DMA_CHANNEL);
+		UDMA_USEBURSTCLR = BIT(UART_TX_DMA_CHANNEL);
+		UDMA_REQMASKCLR = BIT(UART_TX_DMA_CHANNEL);
+		Uart_DmaControlTable[UART_TX_DMA_CHANNEL].DSTENDP =
+			(uint32)&UART_REG(UART0_BASE_ADDRESS, UART_O_DR);
+
+		Uart_TxHead = 0U;
+		Uart_TxTail = 0U;
+		Uart_TxChunk = 0U;
+		Uart_RxHead = 0U;
+		Uart_RxTail = 0U;
+		Uart_Statistics.TxDropped = 0U;
+		Uart_Statistics.RxDropped = 0U;
+		Uart_Statistics.RxErrors = 0U;
+		Uart_Statistics.RxOverruns = 0U;
+
+		if (E_OK == Irq_Install(UART_IRQ_NUMBER, UART0_Handler, UART_INTERRUPT_PRIORITY))
+		{
+			UART_REG(UART0_BASE_ADDRESS, UART_O_CTL) = UART_CTL_ENABLE | UART_CTL_SPEED;
+			Uart_Initialized = TRUE;
+		}
+		else
+		{
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+			Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_INIT_SID, UART_E_INIT_FAILED);
+#endif
+		}
+	}
+}
+
+/************************************************************************************
+ * Service name      : Uart_Write
+*  Syntax            : Uart_LengthType Uart_Write(const uint8* DataPtr, Uart_LengthType Length)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x01
+*  Sync/Async        : Asynchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : DataPtr - Bytes to send
+*                      Length - Number of bytes
+*  Parameters (inout): None
+*  Parameters (out)  : None
+*  Return value      : Uart_LengthType - Number of bytes copied into the transmit buffer, the
+*                      others are counted in TxDropped
+*  Description       : Function to queue bytes for transmission, it never waits for the line.
+ ************************************************************************************/
+Uart_LengthType Uart_Write(const uint8* DataPtr, Uart_LengthType Length)
+{
+	Uart_LengthType Accepted = 0U;
+
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+	if (FALSE == Uart_Initialized)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_WRITE_SID, UART_E_UNINIT);
+	}
+	else if (NULL_PTR == DataPtr)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_WRITE_SID, UART_E_PARAM_POINTER);
+	}
+	else
+#endif
+	{
+		uint32 Head = Uart_TxHead;
+		uint32 Free = UART_TX_BUFFER_SIZE - (Head - Uart_TxTail);
+
+		Accepted = (Length < Free) ? Length : (Uart_LengthType)Free;
+
+		for (uint32 Index = 0U; Index < Accepted; Index++)
+		{
+			Uart_TxBuffer[(Head + Index) & (UART_TX_BUFFER_SIZE - 1U)] = DataPtr[Index];
+		}
+
+		/* The bytes are in the buffer before the interrupt can see them */
+		DATA_SYNC_BARRIER();
+		Uart_TxHead = Head + Accepted;
+		Uart_Statistics.TxDropped += (uint32)Length - Accepted;
+
+		if ((0U != Accepted) && (0U == Uart_TxChunk))
+		{
+			(void)Irq_SetPending(UART_IRQ_NUMBER);
+		}
+		else
+		{
+			/* The end of the running transfer starts the next one */
+		}
+	}
+
+	return Accepted;
+}
+
+/************************************************************************************
+ * Service name      : Uart_Read
+*  Syntax            : Uart_LengthType Uart_Read(uint8* DataPtr, Uart_LengthType Length)
+*  Mode              : Supervisor Mode (Privileged Mode)
+*  Service ID[hex]   : 0x02
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Non reentrant
+*  Parameters (in)   : Length - Size of the DataPtr buffer
+*  Parameters (inout): None
+*  Parameters (out)  : DataPtr - Bytes received, oldest first
+*  Return value      : Uart_LengthType - Number of bytes moved to DataPtr, 0 if none was received
+*  Description       : Function to take the received bytes out of the receive buffer.
+ ************************************************************************************/
+Uart_LengthType Uart_Read(uint8* DataPtr, Uart_LengthType Length)
+{
+	Uart_LengthType Received = 0U;
+
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+	if (FALSE == Uart_Initialized)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_READ_SID, UART_E_UNINIT);
+	}
+	else if (NULL_PTR == DataPtr)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_READ_SID, UART_E_PARAM_POINTER);
+	}
+	else
+#endif
+	{
+		uint32 Tail = Uart_RxTail;
+		uint32 Available = Uart_RxHead - Tail;
+
+		Received = (Length < Available) ? Length : (Uart_LengthType)Available;
+
+		for (uint32 Index = 0U; Index < Received; Index++)
+		{
+			DataPtr[Index] = Uart_RxBuffer[(Tail + Index) & (UART_RX_BUFFER_SIZE - 1U)];
+		}
+
+		/* The bytes are copied before the interrupt can overwrite them */
+		DATA_SYNC_BARRIER();
+		Uart_RxTail = Tail + Received;
+	}
+
+	return Received;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Uart_GetStatistics(Uart_StatisticsType* StatisticsPtr)
+{
+	Std_ReturnType Status = E_NOT_OK;
+
+#if (UART_DEV_ERROR_DETECT == STD_ON)
+	if (FALSE == Uart_Initialized)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_GET_STATISTICS_SID, UART_E_UNINIT);
+	}
+	else if (NULL_PTR == StatisticsPtr)
+	{
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_GET_STATISTICS_SID, UART_E_PARAM_POINTER);
+	}
+	else
+#endif
+	{
+		*StatisticsPtr = Uart_Statistics;
+		Status = E_OK;
+	}
+
+	return Status;
+}
+
+/************************************************************************************
+*  Service name      : Uart_GetVersionInfo
+*  Syntax            : void Uart_GetVersionInfo(Std_VersionInfoType* versioninfo )
+*  Mode              : User Mode (Non-Privileged Mode)
+*  Service ID[hex]   : 0x04
+*  Sync/Async        : Synchronous
+*  Reentrancy        : Reentrant
+*  Parameters (in)   : None
+*  Parameters (inout): None
+*  Parameters (out)  : versioninfo - Pointer to where to store the version
+*                      information of this module.
+*  Return value      : None
+*  Description       : Service to get the version information of this module
+ ************************************************************************************/
+#if (UART_VERSION_INFO_API == STD_ON)
+void Uart_GetVersionInfo(Std_VersionInfoType* versioninfo)
+{
+	#if (UART_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(UART_MODULE_ID, UART_INSTANCE_ID, UART_GET_VERSION_INFO_SID, UART_E_PARAM_POINTER);
+	}
+	else
+	#endif /* (UART_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)UART_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)UART_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)UART_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)UART_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)UART_SW_PATCH_VERSION;
+	}
+}
+#endif
@@ -0,0 +1,141 @@
+/******************************************************************
+ * @Module   	: Uart
+ * @Title 	 	: UART Driver Header File
+ * @Filename 	: Uart.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	: UART0 on PA0/PA1 (PortConf_UART0_ACTIVE_PROFILE_ID). Uart_Write copies into a ring
+ *                buffer that the uDMA sends to the TX FIFO, Uart_Read empties the ring buffer the
+ *                UART0 interrupt fills from the RX FIFO. Neither of them ever waits for the line.
+ ********************************************************************/
+
+#ifndef UART_H
+#define UART_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define UART_VENDOR_ID				  (1000U)
+
+/* Uart Module Id, Complex Device Driver as AUTOSAR has no UART driver */
+#define UART_MODULE_ID				  (255U)
+
+/* Uart Instance Id */
+#define UART_INSTANCE_ID			  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define UART_SW_MAJOR_VERSION		  (1U)
+#define UART_SW_MINOR_VERSION		  (0U)
+#define UART_SW_PATCH_VERSION		  (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define UART_AR_RELEASE_MAJOR_VERSION (4U)
+#define UART_AR_RELEASE_MINOR_VERSION (0U)
+#define UART_AR_RELEASE_PATCH_VERSION (3U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Uart Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != UART_AR_RELEASE_MAJOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_MINOR_VERSION != UART_AR_RELEASE_MINOR_VERSION) || \
+	 (STD_TYPES_AR_RELEASE_PATCH_VERSION != UART_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Uart Pre-Compile Configuration Header file */
+#include "Uart_Cfg.h"
+
+/* AUTOSAR Version checking between Uart_Cfg.h and Uart.h files */
+#if ((UART_CFG_AR_RELEASE_MAJOR_VERSION != UART_AR_RELEASE_MAJOR_VERSION) || \
+	 (UART_CFG_AR_RELEASE_MINOR_VERSION != UART_AR_RELEASE_MINOR_VERSION) || \
+	 (UART_CFG_AR_RELEASE_PATCH_VERSION != UART_AR_RELEASE_PATCH_VERSION))
+	#error "The AR version of Uart_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Uart_Cfg.h and Uart.h files */
+#if ((UART_CFG_SW_MAJOR_VERSION != UART_SW_MAJOR_VERSION) || \
+	 (UART_CFG_SW_MINOR_VERSION != UART_SW_MINOR_VERSION) || \
+	 (UART_CFG_SW_PATCH_VERSION != UART_SW_PATCH_VERSION))
+	#error "The SW version of Uart_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for UART Init */
+#define UART_INIT_SID				  (uint8)0x00
+
+/* Service ID for UART Write */
+#define UART_WRITE_SID				  (uint8)0x01
+
+/* Service ID for UART Read */
+#define UART_READ_SID				  (uint8)0x02
+
+/* Service ID for UART GetStatistics */
+#define UART_GET_STATISTICS_SID		  (uint8)0x03
+
+/* Service ID for UART GetVersionInfo */
+#define UART_GET_VERSION_INFO_SID	  (uint8)0x04
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* DET code to report that the UART0 interrupt could not be installed (Irq_Init not run yet) */
+#define UART_E_INIT_FAILED			  (uint8)0x10
+
+/* DET code to report that Uart_Init is called while the driver is already initialized */
+#define UART_E_ALREADY_INITIALIZED	  (uint8)0x11
+
+/* DET code to report that an API service is called with a NULL pointer parameter */
+#define UART_E_PARAM_POINTER		  (uint8)0x12
+
+/* DET code to report that an API service is called without module initialization */
+#define UART_E_UNINIT				  (uint8)0x20
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Uart_LengthType, number of bytes of a write or read */
+typedef uint16 Uart_LengthType;
+
+/* Counters of the bytes lost or received in error since Uart_Init */
+typedef struct
+{
+	uint32 TxDropped;	/* bytes refused by Uart_Write, the transmit buffer was full */
+	uint32 RxDropped;	/* bytes received while the receive buffer was full */
+	uint32 RxErrors;	/* bytes received with a framing, parity or break error */
+	uint32 RxOverruns;	/* RX FIFO overruns, the interrupt was held off for 16 bytes */
+} Uart_StatisticsType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for UART Initialization API, to call after Irq_Init and once PA0/PA1 are in their UART modes */
+void Uart_Init(void);
+
+/* Function for UART Write API, copies at most Length bytes into the transmit buffer and returns the
+ * number copied at once. Task context only, Uart_Write is not reentrant. */
+Uart_LengthType Uart_Write(const uint8* DataPtr, Uart_LengthType Length);
+
+/* Function for UART Read API, moves at most Length received bytes to DataPtr and returns their number */
+Uart_LengthType Uart_Read(uint8* DataPtr, Uart_LengthType Length);
+
+/* Function for UART GetStatistics API */
+Std_ReturnType Uart_GetStatistics(Uart_StatisticsType* StatisticsPtr);
+
+#if (UART_VERSION_INFO_API == STD_ON)
+/* Function for UART Get Version Info API */
+void Uart_GetVersionInfo(Std_VersionInfoType* versioninfo);
+#endif
+
+#endif /* UART_H */
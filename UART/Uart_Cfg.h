@@ -0,0 +1,58 @@
+/******************************************************************
+ * @Module   	: Uart
+ * @Title 	 	: UART Driver Pre-Compile Configuration Header File
+ * @Filename 	: Uart_Cfg.h
+ * @target  	: TivaC TM4C123GH6PM Microcontroller
+ * @Author 	 	: Hossam Mohamed
+ * @Compiler 	: IAR
+ * @Notes    	:
+ ********************************************************************/
+
+#ifndef UART_CFG_H
+#define UART_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define UART_CFG_SW_MAJOR_VERSION		  (1U)
+#define UART_CFG_SW_MINOR_VERSION		  (0U)
+#define UART_CFG_SW_PATCH_VERSION		  (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define UART_CFG_AR_RELEASE_MAJOR_VERSION (4U)
+#define UART_CFG_AR_RELEASE_MINOR_VERSION (0U)
+#define UART_CFG_AR_RELEASE_PATCH_VERSION (3U)
+
+/* Pre-compile option for the use of UART0 by the application: STD_OFF leaves PA0/PA1 in their GPIO
+ * modes and the driver is never initialized */
+#define UART_ENABLED					  (STD_ON)
+
+/* Pre-compile option for Development Error Detect */
+#define UART_DEV_ERROR_DETECT			  (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define UART_VERSION_INFO_API			  (STD_ON)
+
+/* Clock of UART0, the system clock */
+#define UART_CLOCK_FREQUENCY_HZ			  (16000000U)
+
+/* Line rate, 8 data bits, no parity, 1 stop bit */
+#define UART_BAUD_RATE					  (1000000U)
+
+/* Sample the line 8 times per bit instead of 16 (UARTCTL.HSE): needed above UART_CLOCK_FREQUENCY_HZ / 16,
+ * up to 2 Mbaud at 16 MHz */
+#define UART_HIGH_SPEED					  (STD_OFF)
+
+/* Size of the transmit ring buffer in bytes, a power of 2. Uart_Write only accepts what fits in it */
+#define UART_TX_BUFFER_SIZE				  (1024U)
+
+/* Size of the receive ring buffer in bytes, a power of 2. Bytes received while it is full are dropped */
+#define UART_RX_BUFFER_SIZE				  (256U)
+
+/* Priority of the UART0 interrupt (0 - 7), below the button interrupts: the RX FIFO holds 16 bytes,
+ * 160 us at 1 Mbaud, and the transmit side is fed by the uDMA */
+#define UART_INTERRUPT_PRIORITY			  (3U)
+
+#endif /* UART_CFG_H */
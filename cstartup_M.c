@@ -12,6 +12,8 @@
 #pragma language = extended
 #pragma segment = "CSTACK"
 
+// __iar_program_start copies the initialized data to the SRAM before calling main, with it the
+// FUNC_RAM functions (__ramfunc, section .textrw) and the CONST_FAST tables (see Compiler.h).
 extern void __iar_program_start(void);
 
 extern void NMI_Handler(void);
@@ -23,8 +25,18 @@ extern void SVC_Handler(void);
 extern void DebugMon_Handler(void);
 extern void PendSV_Handler(void);
 extern void SysTick_Handler(void);
+extern void Default_Handler(void);
 
+extern void GPIOPortA_Handler(void);
+extern void GPIOPortB_Handler(void);
+extern void GPIOPortC_Handler(void);
+extern void GPIOPortD_Handler(void);
+extern void GPIOPortE_Handler(void);
 extern void GPIOPortF_Handler(void);
+extern void Timer0A_Handler(void);
+extern void Timer1A_Handler(void);
+extern void Timer2A_Handler(void);
+extern void Timer3A_Handler(void);
 
 typedef void (*intfunc)(void);
 typedef union
@@ -42,8 +54,11 @@ typedef union
 // If vector table is not located at address 0, the user has to initialize
 // the  NVIC vector table register (VTOR) before using interrupts.
 
+// All the 155 vectors of the TM4C123GH6PM, Irq_Init copies them to the SRAM table used through VTOR.
+// The interrupts without a driver enter Default_Handler until a driver installs its handler with
+// Irq_Install, an unexpected interrupt then stops there instead of jumping to address 0.
 #pragma location = ".intvec"
-const intvec_elem __vector_table[] = {
+const intvec_elem __vector_table[155] = {
 	{.__ptr = __sfe("CSTACK")},
 	__iar_program_start,
 
@@ -62,38 +77,145 @@ const intvec_elem __vector_table[] = {
 	PendSV_Handler,
 	SysTick_Handler, /* Interrupt 15*/
 	/* TM4C123GH6PM Specific Interrupts */
-	0,				  /*16 */
-	0,				  /*17 */
-	0,				  /*18 */
-	0,				  /*19 */
-	0,				  /*20 */
-	0,				  /*21 */
-	0,				  /*22 */
-	0,				  /*23 */
-	0,				  /*24 */
-	0,				  /*25 */
-	0,				  /*26 */
-	0,				  /*27 */
-	0,				  /*28 */
-	0,				  /*29 */
-	0,				  /*30 */
-	0,				  /*31 */
-	0,				  /*32 */
-	0,				  /*33 */
-	0,				  /*34 */
-	0,				  /*35 */
-	0,				  /*36 */
-	0,				  /*37 */
-	0,				  /*38 */
-	0,				  /*39 */
-	0,				  /*40 */
-	0,				  /*41 */
-	0,				  /*42 */
-	0,				  /*43 */
-	0,				  /*44 */
-	0,				  /*45 */
-	GPIOPortF_Handler /*46 */
-
+	GPIOPortA_Handler, /*16 */
+	GPIOPortB_Handler, /*17 */
+	GPIOPortC_Handler, /*18 */
+	GPIOPortD_Handler, /*19 */
+	GPIOPortE_Handler, /*20 */
+	Default_Handler,   /*21 */
+	Default_Handler,   /*22 */
+	Default_Handler,   /*23 */
+	Default_Handler,   /*24 */
+	Default_Handler,   /*25 */
+	Default_Handler,   /*26 */
+	Default_Handler,   /*27 */
+	Default_Handler,   /*28 */
+	Default_Handler,   /*29 */
+	Default_Handler,   /*30 */
+	Default_Handler,   /*31 */
+	Default_Handler,   /*32 */
+	Default_Handler,   /*33 */
+	Default_Handler,   /*34 */
+	Timer0A_Handler,   /*35 */
+	Default_Handler,   /*36 */
+	Timer1A_Handler,   /*37 */
+	Default_Handler,   /*38 */
+	Timer2A_Handler,   /*39 */
+	Default_Handler,   /*40 */
+	Default_Handler,   /*41 */
+	Default_Handler,   /*42 */
+	Default_Handler,   /*43 */
+	Default_Handler,   /*44 */
+	Default_Handler,   /*45 */
+	GPIOPortF_Handler, /*46 */
+	Default_Handler,   /*47 */
+	Default_Handler,   /*48 */
+	Default_Handler,   /*49 */
+	Default_Handler,   /*50 */
+	Timer3A_Handler,   /*51 */
+	Default_Handler,   /*52 */
+	Default_Handler,   /*53 */
+	Default_Handler,   /*54 */
+	Default_Handler,   /*55 */
+	Default_Handler,   /*56 */
+	Default_Handler,   /*57 */
+	Default_Handler,   /*58 */
+	Default_Handler,   /*59 */
+	Default_Handler,   /*60 */
+	Default_Handler,   /*61 */
+	Default_Handler,   /*62 */
+	Default_Handler,   /*63 */
+	Default_Handler,   /*64 */
+	Default_Handler,   /*65 */
+	Default_Handler,   /*66 */
+	Default_Handler,   /*67 */
+	Default_Handler,   /*68 */
+	Default_Handler,   /*69 */
+	Default_Handler,   /*70 */
+	Default_Handler,   /*71 */
+	Default_Handler,   /*72 */
+	Default_Handler,   /*73 */
+	Default_Handler,   /*74 */
+	Default_Handler,   /*75 */
+	Default_Handler,   /*76 */
+	Default_Handler,   /*77 */
+	Default_Handler,   /*78 */
+	Default_Handler,   /*79 */
+	Default_Handler,   /*80 */
+	Default_Handler,   /*81 */
+	Default_Handler,   /*82 */
+	Default_Handler,   /*83 */
+	Default_Handler,   /*84 */
+	Default_Handler,   /*85 */
+	Default_Handler,   /*86 */
+	Default_Handler,   /*87 */
+	Default_Handler,   /*88 */
+	Default_Handler,   /*89 */
+	Default_Handler,   /*90 */
+	Default_Handler,   /*91 */
+	Default_Handler,   /*92 */
+	Default_Handler,   /*93 */
+	Default_Handler,   /*94 */
+	Default_Handler,   /*95 */
+	Default_Handler,   /*96 */
+	Default_Handler,   /*97 */
+	Default_Handler,   /*98 */
+	Default_Handler,   /*99 */
+	Default_Handler,   /*100 */
+	Default_Handler,   /*101 */
+	Default_Handler,   /*102 */
+	Default_Handler,   /*103 */
+	Default_Handler,   /*104 */
+	Default_Handler,   /*105 */
+	Default_Handler,   /*106 */
+	Default_Handler,   /*107 */
+	Default_Handler,   /*108 */
+	Default_Handler,   /*109 */
+	Default_Handler,   /*110 */
+	Default_Handler,   /*111 */
+	Default_Handler,   /*112 */
+	Default_Handler,   /*113 */
+	Default_Handler,   /*114 */
+	Default_Handler,   /*115 */
+	Default_Handler,   /*116 */
+	Default_Handler,   /*117 */
+	Default_Handler,   /*118 */
+	Default_Handler,   /*119 */
+	Default_Handler,   /*120 */
+	Default_Handler,   /*121 */
+	Default_Handler,   /*122 */
+	Default_Handler,   /*123 */
+	Default_Handler,   /*124 */
+	Default_Handler,   /*125 */
+	Default_Handler,   /*126 */
+	Default_Handler,   /*127 */
+	Default_Handler,   /*128 */
+	Default_Handler,   /*129 */
+	Default_Handler,   /*130 */
+	Default_Handler,   /*131 */
+	Default_Handler,   /*132 */
+	Default_Handler,   /*133 */
+	Default_Handler,   /*134 */
+	Default_Handler,   /*135 */
+	Default_Handler,   /*136 */
+	Default_Handler,   /*137 */
+	Default_Handler,   /*138 */
+	Default_Handler,   /*139 */
+	Default_Handler,   /*140 */
+	Default_Handler,   /*141 */
+	Default_Handler,   /*142 */
+	Default_Handler,   /*143 */
+	Default_Handler,   /*144 */
+	Default_Handler,   /*145 */
+	Default_Handler,   /*146 */
+	Default_Handler,   /*147 */
+	Default_Handler,   /*148 */
+	Default_Handler,   /*149 */
+	Default_Handler,   /*150 */
+	Default_Handler,   /*151 */
+	Default_Handler,   /*152 */
+	Default_Handler,   /*153 */
+	Default_Handler,   /*154 */
 };
 
 #pragma call_graph_root = "interrupt"
@@ -159,6 +281,13 @@ __weak void SysTick_Handler(void)
 	{
 	}
 }
+#pragma call_graph_root = "interrupt"
+__weak void Default_Handler(void)
+{
+	while (1)
+	{
+	}
+}
 
 void		__cmain(void);
 __weak void __iar_init_core(void);